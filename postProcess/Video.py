@@ -10,6 +10,11 @@ The helper executables ``postProcess/getFacet`` and ``postProcess/getData``
 are compiled as part of the Basilisk workflow. This Python wrapper shells
 out to those binaries for every snapshot, reshapes the returned grids, and
 renders axisymmetric visualizations with strain-rate and velocity fields.
+By default a single ``getData --bundle`` call restores each snapshot once
+and returns both the interface facets and the sampled fields in binary;
+``--separate-helpers`` falls back to two helper calls (getFacet, getData);
+``--text-facets`` additionally reads getFacet's text output, for helper
+builds without ``--binary``. Text payloads are parsed in one NumPy pass.
 
 Usage
 -----
@@ -27,15 +32,24 @@ Last updated: Jan 2025
 """
 
 import argparse
+import hashlib
+import io
+import json
 import multiprocessing as mp
 import os
+import re
+import shutil
 import subprocess as sp
-from dataclasses import dataclass
+import time as clock
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass, replace
 from functools import partial
 from datetime import datetime
 from typing import Sequence, Tuple, Optional
 
 import matplotlib
+import matplotlib.image
 import matplotlib.pyplot as plt
 import numpy as np
 from matplotlib.collections import LineCollection
@@ -85,9 +99,9 @@ class RuntimeConfig:
     """
 
     cpus: int
-    n_snapshots: int
+    n_snapshots: int  # cap on discovered snapshots (0: all)
     grids_per_r: int
-    tsnap: float
+    tsnap: float  # minimum time between rendered snapshots (0: all)
     zmin: float
     zmax: float
     rmax: float
@@ -100,6 +114,23 @@ class RuntimeConfig:
     d2_vmax: float
     vel_vmin: float
     vel_vmax: float
+    helper_mpi: int = 0  # MPI ranks per helper call (0: serial helpers)
+    combined_extraction: bool = True  # one getData --bundle call per frame
+    text_facets: bool = False  # read getFacet's text output instead of --binary
+    simplify: float = 0.0  # max facet deviation for simplification (0: off)
+    renderer: str = "matplotlib"  # frame renderer, see RENDERERS
+    stream: bool = False  # pipe raw frames into ffmpeg instead of PNG files
+    keep_frames: bool = False  # with stream: also write the PNG frames
+    cache_dir: str = ""  # extraction cache folder, "{case}" = case_dir ("" disables the cache)
+    watch: bool = False  # follow intermediate/ while the simulation runs
+    poll_interval: float = 5.0  # seconds between scans in watch mode
+    idle_timeout: float = 0.0  # stop watching after this long without snapshots (0: never)
+    preview_frames: int = 100  # frames in the rolling preview video
+    cases: Tuple[Tuple[str, float, float], ...] = ()  # (case_dir, zmin, zmax) sharing one pool
+    segments: int = 1  # video segments encoded in parallel, then concatenated
+    prune: bool = False  # delete frames of the output folder that are not planned
+    montage: bool = False  # render `cases` side by side into one video
+    montage_width: int = 3840  # montage frame width in pixels
 
     @property
     def rmin(self) -> float:
@@ -129,6 +160,8 @@ class PlotStyle:
     colorbar_width: float = 0.03
     left_colorbar_offset: float = 0.04
     right_colorbar_offset: float = 0.01
+    dpi: int = 100  # figure_size * dpi = frame size in pixels
+    axes_rect: Tuple[float, float, float, float] = (0.1, 0.03, 0.8, 0.9)
 
 
 @dataclass(frozen=True)
@@ -144,6 +177,9 @@ class SnapshotInfo:
     time: float
     source: str
     target: str
+    size: int = 0  # snapshot bytes, the scheduler's cost estimate
+    inputs: str = ""  # hash of everything the frame depends on
+    fresh: bool = False  # target exists and was rendered from `inputs`
 
 
 @dataclass
@@ -189,7 +225,8 @@ def parse_arguments() -> RuntimeConfig:
     )
     parser.add_argument("--CPUs", type=int, default=4, help="Number of CPUs to use")
     parser.add_argument(
-        "--nGFS", type=int, default=500, help="Number of restart files to process"
+        "--nGFS", type=int, default=500,
+        help="Maximum number of snapshots to process (default: 500, 0: all)"
     )
     parser.add_argument(
         "--GridsPerR", type=int, default=256, help="Number of grids per R"
@@ -203,7 +240,11 @@ def parse_arguments() -> RuntimeConfig:
     parser.add_argument(
         "--RMAX", type=float, default=2.0, help="Maximum R value (default: 2.0)"
     )
-    parser.add_argument("--tsnap", type=float, default=0.01, help="Time snap interval")
+    parser.add_argument(
+        "--tsnap", type=float, default=0.01,
+        help="Minimum time between rendered snapshots; finer output is "
+             "thinned, 0 renders every snapshot (default: 0.01)"
+    )
     parser.add_argument(
         "--caseToProcess",
         type=str,
@@ -241,10 +282,115 @@ def parse_arguments() -> RuntimeConfig:
         "--vel-vmax", type=float, default=1.0,
         help="Max value for velocity colorbar (default: 1.0)"
     )
+    parser.add_argument(
+        "--helper-mpi", type=int, default=0,
+        help="Run MPI-built getData/getFacet with this many ranks (default: 0, serial)"
+    )
+    parser.add_argument(
+        "--separate-helpers", action="store_true",
+        help="Call getFacet and getData separately instead of one bundle"
+    )
+    parser.add_argument(
+        "--text-facets", action="store_true",
+        help="Read getFacet's text output instead of --binary, for helper "
+             "builds without it (implies --separate-helpers)"
+    )
+    parser.add_argument(
+        "--simplify", type=float, default=0.0,
+        help="Simplify the interface to this max deviation in simulation units, "
+             "e.g. half a pixel (default: 0, off)"
+    )
+    parser.add_argument(
+        "--renderer", choices=("matplotlib", "raster"), default="matplotlib",
+        help="Frame renderer: persistent matplotlib figure, or the NumPy "
+             "rasterizer for fixed-colormap production videos (default: matplotlib)"
+    )
+    parser.add_argument(
+        "--stream", action="store_true",
+        help="Pipe raw RGB frames into ffmpeg in time order instead of "
+             "writing PNG frames and encoding them afterwards"
+    )
+    parser.add_argument(
+        "--keep-frames", action="store_true",
+        help="With --stream, also write the PNG frames to the output folder"
+    )
+    parser.add_argument(
+        "--cache", action="store_true",
+        help="Keep the helper output in {case}/extraction-cache and reuse it "
+             "when re-rendering with new colorbars or styles. Each entry holds "
+             "float32 D2 and velocity grids, ~8 bytes per grid point: about "
+             "10 MB per snapshot at the default 512 x 2560 grid (5 GB per 500 "
+             "snapshots)"
+    )
+    parser.add_argument(
+        "--cache-dir", type=str, default=None,
+        help="Cache folder, implies --cache; {case} expands to the case folder"
+    )
+    parser.add_argument(
+        "--watch", action="store_true",
+        help="Follow intermediate/ while the simulation runs: render each new "
+             "snapshot, refresh a rolling preview video and the metrics plot"
+    )
+    parser.add_argument(
+        "--poll-interval", type=float, default=5.0,
+        help="Seconds between scans of intermediate/ in watch mode (default: 5)"
+    )
+    parser.add_argument(
+        "--idle-timeout", type=float, default=0.0,
+        help="Stop watching after this many seconds without a new snapshot "
+             "(default: 0, watch until interrupted)"
+    )
+    parser.add_argument(
+        "--preview-frames", type=int, default=100,
+        help="Number of latest frames in the watch-mode preview video (default: 100)"
+    )
+    parser.add_argument(
+        "--case", nargs=3, action="append", default=[],
+        metavar=("CASE_DIR", "ZMIN", "ZMAX"),
+        help="Render several cases from one shared worker pool (repeat per "
+             "case); frames go to <case>/Video and each video is encoded as "
+             "soon as its case's frames are done. Overrides --caseToProcess"
+    )
+    parser.add_argument(
+        "--segments", type=int, default=1,
+        help="Encode the video as N segments in parallel, each started as "
+             "soon as its frames are rendered, and concatenate them without "
+             "re-encoding (default: 1, a single ffmpeg pass)"
+    )
+    parser.add_argument(
+        "--prune", action="store_true",
+        help="Delete frames of the output folder that are not in this run's "
+             "plan (deleted snapshots, old --tsnap); the video only ever "
+             "encodes planned frames, so this just frees the disk space"
+    )
+    parser.add_argument(
+        "--montage", action="store_true",
+        help="With --case: render all cases side by side at matched times "
+             "into one video (frames in --folderToSave, default: montage/ "
+             "next to the first case)"
+    )
+    parser.add_argument(
+        "--montage-width", type=int, default=3840,
+        help="Width of the montage frames in pixels (default: 3840)"
+    )
     args = parser.parse_args()
+    if args.case and (args.stream or args.watch):
+        parser.error("--case cannot be combined with --stream or --watch")
+    if args.case and args.folderToSave and not args.montage:
+        parser.error("--folderToSave with --case needs --montage (frames go to <case>/Video)")
+    if args.montage and not args.case:
+        parser.error("--montage needs the cases, given with --case")
+    try:
+        cases = tuple((d, float(z0), float(z1)) for d, z0, z1 in args.case)
+    except ValueError:
+        parser.error("--case expects CASE_DIR ZMIN ZMAX with numeric bounds")
 
     output_dir = (args.folderToSave if args.folderToSave
                   else os.path.join(args.caseToProcess, "Video"))
+    if args.montage and not args.folderToSave:
+        output_dir = os.path.join(os.path.dirname(os.path.normpath(args.case[0][0])), "montage")
+    cache_dir = args.cache_dir if args.cache_dir else (
+        os.path.join("{case}", "extraction-cache") if args.cache else "")
 
     return RuntimeConfig(
         cpus=args.CPUs,
@@ -263,6 +409,23 @@ def parse_arguments() -> RuntimeConfig:
         d2_vmax=args.d2_vmax,
         vel_vmin=args.vel_vmin,
         vel_vmax=args.vel_vmax,
+        helper_mpi=args.helper_mpi,
+        combined_extraction=not (args.separate_helpers or args.text_facets),
+        text_facets=args.text_facets,
+        simplify=args.simplify,
+        renderer=args.renderer,
+        stream=args.stream and not args.skip_video_encode,
+        keep_frames=args.keep_frames,
+        cache_dir=cache_dir,
+        watch=args.watch,
+        poll_interval=args.poll_interval,
+        idle_timeout=args.idle_timeout,
+        preview_frames=args.preview_frames,
+        cases=cases,
+        segments=max(1, args.segments),
+        prune=args.prune,
+        montage=args.montage,
+        montage_width=args.montage_width,
     )
 
 
@@ -272,9 +435,15 @@ def ensure_directory(path: str) -> None:
         os.makedirs(path, exist_ok=True)
 
 
-def run_helper(command: Sequence[str], cwd: Optional[str] = None) -> Sequence[str]:
+def helper_command(helper: str, args: Sequence[str], mpi_ranks: int = 0) -> list:
+    """Build a helper invocation, wrapped in ``mpirun`` for MPI-built helpers."""
+    launcher = ["mpirun", "-np", str(mpi_ranks)] if mpi_ranks > 0 else []
+    return launcher + [helper] + list(args)
+
+
+def run_helper(command: Sequence[str], cwd: Optional[str] = None) -> str:
     """
-    Run a helper executable and return its stderr as decoded lines.
+    Run a helper executable and return its decoded stderr.
 
     The compiled helpers deliberately emit their payload to stderr, so stdout is
     ignored and we return the informative stderr content.
@@ -289,44 +458,104 @@ def run_helper(command: Sequence[str], cwd: Optional[str] = None) -> Sequence[st
             f"Command {' '.join(command)} failed with code {process.returncode}:\n"
             f"{stderr.decode('utf-8')}"
         )
-    return stderr.decode("utf-8").split("\n")
+    return stderr.decode("utf-8")
 
 
-def get_facets(filename: str, case_dir: str):
+def run_helper_binary(command: Sequence[str], cwd: Optional[str] = None) -> bytes:
+    """
+    Run a helper executable in a binary mode and return its raw stdout.
+
+    Binary payloads (``.npy`` records) are written to stdout so that
+    diagnostic messages on stderr cannot corrupt them.
+    """
+    process = sp.Popen(command, stdout=sp.PIPE, stderr=sp.PIPE, cwd=cwd)
+    stdout, stderr = process.communicate()
+    if process.returncode != 0:
+        raise RuntimeError(
+            f"Command {' '.join(command)} failed with code {process.returncode}:\n"
+            f"{stderr.decode('utf-8')}"
+        )
+    return stdout
+
+
+def parse_text_rows(text: str, columns: int) -> np.ndarray:
+    """Parse whitespace-separated numbers into an ``(n, columns)`` array.
+
+    One ``np.fromstring`` pass over the whole payload; blank lines and line
+    breaks are just separators, so row structure comes from ``columns``.
+    """
+    try:
+        values = np.fromstring(text, dtype=float, sep=" ")
+    except ValueError as err:  # non-numeric text, e.g. a diagnostic message
+        raise RuntimeError(f"Unexpected helper output: {err}") from err
+    if values.size % columns:
+        raise RuntimeError(
+            f"Helper output has {values.size} values, not a multiple of {columns}"
+        )
+    return values.reshape(-1, columns)
+
+
+def mirror_facets(xy: np.ndarray) -> np.ndarray:
+    """Convert ``x0 y0 x1 y1`` facet rows to mirrored ``(r, z)`` segments.
+
+    Basilisk's x is the axial (z) and y the radial (r) coordinate. Returns an
+    array of shape ``(2 * n, 2, 2)`` holding each segment and its reflection
+    about r = 0, directly usable by ``LineCollection``.
+    """
+    xy = np.asarray(xy, dtype=float).reshape(-1, 4)
+    right = np.stack((xy[:, [1, 0]], xy[:, [3, 2]]), axis=1)
+    left = right * np.array([-1.0, 1.0])
+    return np.concatenate((right, left))
+
+
+def get_facets(
+    filename: str,
+    case_dir: str,
+    mpi_ranks: int = 0,
+    simplify: float = 0.0,
+    bbox: Optional[Sequence[float]] = None,
+    text: bool = False,
+) -> np.ndarray:
     """Collect interface facets from getFacet helper with axisymmetric mirroring.
 
-    Shells out to the compiled ``getFacet`` executable, which extracts the
-    volume-of-fluid (VOF) interface as a sequence of line segments. Since
-    the simulation uses axisymmetric coordinates, only the r >= 0 half is
-    computed. This function mirrors each segment about r=0.
+    Shells out to the compiled ``getFacet`` executable in ``--binary`` mode,
+    which writes the volume-of-fluid (VOF) interface as one ``.npy`` array of
+    line segments. Since the simulation uses axisymmetric coordinates, only
+    the r >= 0 half is computed. This function mirrors each segment about r=0.
 
     #### Args
     - `filename`: Relative path to snapshot file (e.g., `intermediate/snapshot-0.0100`).
     - `case_dir`: Absolute path to case directory (used as `cwd`).
+    - `mpi_ranks`: Ranks for an MPI-built helper (0 runs it serially).
+    - `simplify`: Max deviation for Douglas-Peucker simplification (0: off).
+    - `bbox`: Optional ``(xmin, ymin, xmax, ymax)`` in Basilisk coordinates
+      restricting the extraction to the rendered window.
+    - `text`: Read the ``x y`` text pairs on stderr instead of ``--binary``.
 
     #### Returns
-    - `list[tuple]`: Sequence of line segments, each as `((r1, z1), (r2, z2))`.
-    """
-    temp2 = run_helper([HELPER_GETFACET, filename], cwd=case_dir)
-    segs = []
-    skip = False
-    if len(temp2) > 1e2:
-        for n1 in range(len(temp2)):
-            temp3 = temp2[n1].split(" ")
-            if temp3 == [""]:
-                skip = False
-                continue
-            if not skip and n1 + 1 < len(temp2):
-                temp4 = temp2[n1 + 1].split(" ")
-                r1, z1 = np.array([float(temp3[1]), float(temp3[0])])
-                r2, z2 = np.array([float(temp4[1]), float(temp4[0])])
-                segs.append(((r1, z1), (r2, z2)))
-                segs.append(((-r1, z1), (-r2, z2)))
-                skip = True
-    return segs
-
-
-def get_field(filename: str, case_dir: str, zmin: float, zmax: float, rmax: float, nr: int) -> FieldData:
+    - `np.ndarray`: Segments of shape ``(2 * n, 2, 2)`` as ``((r1, z1), (r2, z2))``.
+    """
+    options = [] if text else ["--binary"]
+    options += ["--simplify", str(simplify)] if simplify > 0 else []
+    if bbox is not None:
+        options += ["--bbox"] + [str(v) for v in bbox]
+    command = helper_command(HELPER_GETFACET, options + [filename], mpi_ranks)
+    if text:
+        # Two "x y" lines per segment: four values per facet row
+        return mirror_facets(parse_text_rows(run_helper(command, cwd=case_dir), 4))
+    payload = run_helper_binary(command, cwd=case_dir)
+    return mirror_facets(np.load(io.BytesIO(payload)))
+
+
+def get_field(
+    filename: str,
+    case_dir: str,
+    zmin: float,
+    zmax: float,
+    rmax: float,
+    nr: int,
+    mpi_ranks: int = 0,
+) -> FieldData:
     """Read field arrays for a single snapshot from getData helper.
 
     Shells out to the compiled ``getData`` executable, which samples the
@@ -339,55 +568,138 @@ def get_field(filename: str, case_dir: str, zmin: float, zmax: float, rmax: floa
     - `zmax`: Maximum axial coordinate for sampling domain.
     - `rmax`: Maximum radial coordinate (positive branch only).
     - `nr`: Number of grid points in radial direction.
+    - `mpi_ranks`: Ranks for an MPI-built helper (0 runs it serially).
 
     #### Returns
     - `FieldData`: Structured container with reshaped 2D arrays.
     """
-    temp2 = run_helper(
-        [
+    text = run_helper(
+        helper_command(
             HELPER_GETDATA,
-            filename,
-            str(zmin),
-            str(0),
-            str(zmax),
-            str(rmax),
-            str(nr),
-        ],
+            [filename, str(zmin), str(0), str(zmax), str(rmax), str(nr)],
+            mpi_ranks,
+        ),
         cwd=case_dir,
     )
-    Rtemp, Ztemp, D2temp, veltemp = [], [], [], []
+    rows = parse_text_rows(text, 4)  # columns z r D2 vel
+    nz = len(rows) // nr
+
+    log_status(f"{os.path.basename(filename)}: nz = {nz}")
+
+    grid = rows[: nz * nr].reshape(nz, nr, 4)
+    return FieldData(
+        R=grid[:, :, 1],
+        Z=grid[:, :, 0],
+        strain_rate=grid[:, :, 2],
+        velocity=grid[:, :, 3],
+        nz=nz,
+    )
 
-    for n1 in range(len(temp2)):
-        temp3 = temp2[n1].split(" ")
-        if temp3 == [""]:
-            continue
-        Ztemp.append(float(temp3[0]))
-        Rtemp.append(float(temp3[1]))
-        D2temp.append(float(temp3[2]))
-        veltemp.append(float(temp3[3]))
 
-    R = np.asarray(Rtemp)
-    Z = np.asarray(Ztemp)
-    D2 = np.asarray(D2temp)
-    vel = np.asarray(veltemp)
-    nz = int(len(Z) / nr)
+def get_bundle(
+    filename: str,
+    case_dir: str,
+    zmin: float,
+    zmax: float,
+    rmax: float,
+    nr: int,
+    mpi_ranks: int = 0,
+    simplify: float = 0.0,
+):
+    """Read facets and field arrays for a snapshot from one getData call.
+
+    Runs ``getData --bundle -`` so the snapshot is restored once; the helper
+    streams two ``.npy`` records to stdout: the facets ``(n, 4)`` and the
+    grid ``(nz, nr, 4)`` with columns ``z r D2 vel``.
+
+    #### Args
+    Same as `get_field`, plus `simplify` as in `get_facets`.
+
+    #### Returns
+    - `tuple`: Mirrored facet segments (see `mirror_facets`) and `FieldData`.
+    """
+    payload = run_helper_binary(
+        helper_command(
+            HELPER_GETDATA,
+            ["--bundle", "-"]
+            + (["--simplify", str(simplify)] if simplify > 0 else [])
+            + [filename, str(zmin), str(0), str(zmax), str(rmax), str(nr)],
+            mpi_ranks,
+        ),
+        cwd=case_dir,
+    )
+    stream = io.BytesIO(payload)
+    facets = mirror_facets(np.load(stream))
+    grid = np.load(stream)
+    nz = grid.shape[0]
 
     log_status(f"{os.path.basename(filename)}: nz = {nz}")
 
-    R.resize((nz, nr))
-    Z.resize((nz, nr))
-    D2.resize((nz, nr))
-    vel.resize((nz, nr))
+    field_data = FieldData(
+        R=grid[:, :, 1],
+        Z=grid[:, :, 0],
+        strain_rate=grid[:, :, 2],
+        velocity=grid[:, :, 3],
+        nz=nz,
+    )
+    return facets, field_data
+
+
+SNAPSHOT_PATTERN = re.compile(r"^snapshot-([0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)$")
+
+
+def frame_name(time: float) -> str:
+    """
+    Frame file name for ``time`` in units of 1e-4, the resolution of the
+    ``snapshot-%5.4f`` names, so distinct snapshots never share a frame.
+    """
+    return f"{round(time * 1e4):09d}.png"
+
 
-    return FieldData(R=R, Z=Z, strain_rate=D2, velocity=vel, nz=nz)
+def build_snapshot_info(
+    index: int, time: float, source: str, config: RuntimeConfig, size: int = 0
+) -> SnapshotInfo:
+    """Construct the frame path for the snapshot ``source`` at ``time``."""
+    target = os.path.join(config.output_dir, frame_name(time))
+    return SnapshotInfo(index=index, time=time, source=source, target=target, size=size)
 
 
-def build_snapshot_info(index: int, config: RuntimeConfig) -> SnapshotInfo:
-    """Construct file paths for a given timestep index."""
-    time = config.tsnap * index
-    source = os.path.join(config.case_dir, "intermediate", f"snapshot-{time:.4f}")
-    target = os.path.join(config.output_dir, f"{int(time * 1000):08d}.png")
-    return SnapshotInfo(index=index, time=time, source=source, target=target)
+def discover_snapshots(config: RuntimeConfig) -> list:
+    """
+    List the snapshots that actually exist in ``<case>/intermediate``.
+
+    Times are parsed from the ``snapshot-<t>`` filenames written by
+    burstingBubble.c, so the work list follows whatever output interval the
+    run used, including restarts and non-uniform output. Snapshots closer
+    than ``tsnap`` to the previously kept one are skipped (0 keeps all), and
+    at most ``n_snapshots`` are returned (0: no limit), in time order.
+    """
+    folder = os.path.join(config.case_dir, "intermediate")
+    try:
+        names = os.listdir(folder)
+    except FileNotFoundError:
+        log_status(f"No snapshot folder: {folder}", level="WARN")
+        return []
+
+    found = []
+    for name in names:
+        match = SNAPSHOT_PATTERN.match(name)
+        if match:
+            found.append((float(match.group(1)), name))
+    found.sort()
+
+    snapshots, last = [], None
+    for time, name in found:
+        if last is not None and time < last + config.tsnap * (1 - 1e-6):
+            continue
+        if config.n_snapshots > 0 and len(snapshots) == config.n_snapshots:
+            break
+        source = os.path.join(folder, name)
+        snapshots.append(
+            build_snapshot_info(len(snapshots), time, source, config, os.path.getsize(source))
+        )
+        last = time
+    return snapshots
 
 
 def draw_domain_outline(ax, bounds: DomainBounds, style: PlotStyle) -> None:
@@ -447,10 +759,348 @@ def add_colorbar(fig, ax, mappable, *, align: str, label: str, style: PlotStyle)
     return colorbar
 
 
+class FrameRenderer:
+    """
+    Persistent figure that renders every frame of one worker process.
+
+    The figure, axes, both images, the interface ``LineCollection``, the
+    colorbars and the title are created once with a fixed layout (axes at
+    ``PlotStyle.axes_rect``, figure size times ``PlotStyle.dpi`` pixels).
+    Each frame only swaps the image data, the facet segments and the title
+    text before ``savefig``; there is no tight-bbox pass, so every frame has
+    the same pixel size, which is what the video encoder wants anyway.
+
+    #### Visualization
+    - Left side: log10(D:D) strain-rate field
+    - Right side: velocity magnitude
+    """
+
+    def __init__(self, config: RuntimeConfig, style: PlotStyle):
+        self.style = style
+        bounds = config.bounds
+        self.fig = plt.figure(figsize=style.figure_size, dpi=style.dpi)
+        width, height = self.fig.canvas.get_width_height()
+        self.shape = (height, width)  # frame size in pixels
+        ax = self.fig.add_axes(style.axes_rect)
+        self.ax = ax
+
+        draw_domain_outline(ax, bounds, style)
+        self.lines = LineCollection(
+            [], linewidths=4, colors=style.interface_color, linestyle="solid"
+        )
+        ax.add_collection(self.lines)
+
+        placeholder = np.zeros((2, 2))
+        self.left = ax.imshow(  # left half: strain-rate field log10(D:D)
+            placeholder,
+            cmap="hot_r",
+            interpolation="bilinear",
+            origin="lower",
+            extent=[0, bounds.rmin, bounds.zmin, bounds.zmax],
+            vmax=config.d2_vmax,
+            vmin=config.d2_vmin,
+        )
+        self.right = ax.imshow(  # right half: velocity magnitude
+            placeholder,
+            interpolation="bilinear",
+            cmap="Purples",
+            origin="lower",
+            extent=[0, bounds.rmax, bounds.zmin, bounds.zmax],
+            vmax=config.vel_vmax,
+            vmin=config.vel_vmin,
+        )
+
+        ax.set_aspect("equal")
+        ax.set_xlim(bounds.rmin, bounds.rmax)
+        ax.set_ylim(bounds.zmin, bounds.zmax)
+        ax.axis("off")
+        ax.apply_aspect()  # fix the axes box before placing the colorbars
+        self.title = ax.set_title("", fontsize=style.tick_label_size)
+
+        add_colorbar(
+            self.fig,
+            ax,
+            self.left,
+            align="left",
+            label=r"$\log_{10}\left(\mu_r(\boldsymbol{\mathcal{D}:\mathcal{D}})\right)$",
+            style=style,
+        )
+        add_colorbar(
+            self.fig,
+            ax,
+            self.right,
+            align="right",
+            label=r"$\|\boldsymbol{u}\|$",
+            style=style,
+        )
+
+    def _update(self, field_data: FieldData, facets, time: float) -> None:
+        """Swap the per-frame data into the persistent artists."""
+        rminp, rmaxp = field_data.radial_extent
+        zminp, zmaxp = field_data.axial_extent
+
+        self.lines.set_segments(facets)
+        self.left.set_data(field_data.strain_rate)
+        self.left.set_extent([-rminp, -rmaxp, zminp, zmaxp])
+        self.right.set_data(field_data.velocity)
+        self.right.set_extent([rminp, rmaxp, zminp, zmaxp])
+        self.title.set_text(f"$t/\\tau_0$ = {time:4.3f}")
+
+    def draw(self, field_data: FieldData, facets, time: float) -> np.ndarray:
+        """Render one frame on the Agg canvas and return it as ``(H, W, 3)`` uint8."""
+        self._update(field_data, facets, time)
+        self.fig.canvas.draw()
+        return np.asarray(self.fig.canvas.buffer_rgba())[:, :, :3].copy()
+
+    def render(self, field_data: FieldData, facets, snapshot: SnapshotInfo) -> None:
+        """Update the artists for one snapshot and write ``snapshot.target``."""
+        self._update(field_data, facets, snapshot.time)
+        self.fig.savefig(snapshot.target, dpi=self.style.dpi)
+
+
+def colormap_lut(name: str) -> np.ndarray:
+    """256-entry uint8 RGB lookup table of a matplotlib colormap."""
+    cmap = matplotlib.colormaps[name]
+    return (cmap(np.linspace(0.0, 1.0, 256))[:, :3] * 255 + 0.5).astype(np.uint8)
+
+
+def render_text_sprite(text: str, fontsize: float, dpi: int, height: int) -> np.ndarray:
+    """Rasterize ``text`` once into an RGBA sprite ``height`` pixels tall.
+
+    The baseline sits at a fixed row for every sprite, so glyphs rendered
+    separately line up when placed side by side.
+    """
+    fig = plt.figure(figsize=(height * 4 / dpi, height / dpi), dpi=dpi)
+    fig.patch.set_alpha(0.0)
+    label = fig.text(0.0, 0.3, text, fontsize=fontsize, va="baseline", ha="left")
+    fig.canvas.draw()
+    rgba = np.asarray(fig.canvas.buffer_rgba()).copy()
+    extent = label.get_window_extent()
+    plt.close(fig)
+    x0 = max(int(np.floor(extent.x0)), 0)
+    x1 = min(int(np.ceil(extent.x1)), rgba.shape[1])
+    return rgba[:, x0:max(x1, x0 + 1)]
+
+
+def blit_sprite(frame: np.ndarray, sprite: np.ndarray, top: int, left: int) -> None:
+    """Alpha-composite an RGBA ``sprite`` onto ``frame`` at ``(top, left)``, clipped."""
+    region = frame[top:top + sprite.shape[0], left:left + sprite.shape[1]]
+    alpha = sprite[: region.shape[0], : region.shape[1], 3:4] / 255.0
+    rgb = sprite[: region.shape[0], : region.shape[1], :3]
+    region[:] = (region * (1 - alpha) + rgb * alpha).astype(np.uint8)
+
+
+class RasterRenderer:
+    """
+    Direct NumPy frame composer for fixed-colormap production videos.
+
+    Reproduces the `FrameRenderer` layout without running matplotlib per
+    frame. At start-up the persistent figure is drawn once without the
+    data to capture the static background (colorbars, labels), the domain
+    outline as an RGBA overlay, the pixel transform of the axes and sprites
+    for the title. Each frame then:
+    - samples both fields bilinearly onto the pixels of their half (weights
+      precomputed per grid shape) and maps them through 256-entry colormap
+      LUTs into uint8 RGB,
+    - draws the mirrored interface with a vectorized line rasterizer
+      (sub-pixel sampling along every segment, stamped with a disc of the
+      line width),
+    - composites the outline and blits the title glyphs.
+    """
+
+    TITLE_GLYPHS = "0123456789.-"
+
+    def __init__(self, config: RuntimeConfig, style: PlotStyle):
+        self.config = config
+        self.style = style
+        figure = FrameRenderer(config, style)
+        fig, ax = figure.fig, figure.ax
+        bounds = config.bounds
+
+        # Axes box in image pixels: column = c0 + (r - rmin) * sx,
+        # row = r0 - (z - zmin) * sz (rows grow downwards)
+        fig.canvas.draw()
+        height = int(fig.bbox.height)
+        (x0, y0), (x1, y1) = ax.transData.transform(
+            [(bounds.rmin, bounds.zmin), (bounds.rmax, bounds.zmax)]
+        )
+        self.sx = (x1 - x0) / (bounds.rmax - bounds.rmin)
+        self.sz = (y1 - y0) / (bounds.zmax - bounds.zmin)
+        self.c0, self.row0 = x0, height - y0
+        self.cols = np.arange(int(np.ceil(x0)), int(np.floor(x1)))
+        self.rows = np.arange(int(np.ceil(height - y1)), int(np.floor(height - y0)))
+        self.r_pixels = bounds.rmin + (self.cols + 0.5 - x0) / self.sx
+        self.z_pixels = bounds.zmin + (height - self.rows - 0.5 - y0) / self.sz
+
+        # Title placement from a representative string
+        figure.title.set_text(f"$t/\\tau_0$ = {0.0:4.3f}")
+        fig.canvas.draw()
+        title_box = figure.title.get_window_extent()
+        self.title_center = 0.5 * (title_box.x0 + title_box.x1)
+
+        # Static layers: everything but the data, then the outline alone
+        figure.title.set_text("")
+        for artist in (figure.left, figure.right, figure.lines):
+            artist.set_visible(False)
+        fig.canvas.draw()
+        self.background = np.asarray(fig.canvas.buffer_rgba())[..., :3].copy()
+        self.shape = self.background.shape[:2]
+        for other in fig.axes:
+            if other is not ax:
+                other.set_visible(False)
+        fig.patch.set_alpha(0.0)
+        ax.patch.set_alpha(0.0)
+        fig.canvas.draw()
+        outline = np.asarray(fig.canvas.buffer_rgba()).reshape(-1, 4)
+        self.outline_index = np.flatnonzero(outline[:, 3])
+        self.outline_alpha = outline[self.outline_index, 3:4] / 255.0
+        self.outline_rgb = outline[self.outline_index, :3].astype(float)
+        plt.close(fig)
+
+        sprite_height = int(2 * style.tick_label_size * style.dpi / 72)
+        self.prefix = render_text_sprite(
+            "$t/\\tau_0$ = ", style.tick_label_size, style.dpi, sprite_height
+        )
+        # Line up the lowest ink of the prefix (the subscript) with the
+        # bottom of the matplotlib title box
+        ink_bottom = np.flatnonzero(self.prefix[..., 3].any(axis=1))[-1]
+        self.title_top = int(round(height - title_box.y0)) - ink_bottom - 1
+        self.glyphs = {
+            g: render_text_sprite(g, style.tick_label_size, style.dpi, sprite_height)
+            for g in self.TITLE_GLYPHS
+        }
+
+        self.luts = (colormap_lut("hot_r"), colormap_lut("Purples"))
+        self.limits = (
+            (config.d2_vmin, config.d2_vmax),
+            (config.vel_vmin, config.vel_vmax),
+        )
+        self.interface_rgb = (
+            np.array(matplotlib.colors.to_rgb(style.interface_color)) * 255
+        ).astype(np.uint8)
+        radius = 4 * style.dpi / 72 / 2  # LineCollection linewidth of 4 pt
+        span = np.arange(-int(np.ceil(radius)), int(np.ceil(radius)) + 1)
+        dr, dc = np.meshgrid(span, span, indexing="ij")
+        inside = dr**2 + dc**2 <= radius**2
+        self.stencil = np.column_stack((dr[inside], dc[inside]))
+        self._weights_key = None
+
+    def _sampling(self, field_data: FieldData):
+        """Bilinear indices/weights of the pixel grid, cached per grid layout."""
+        rminp, rmaxp = field_data.radial_extent
+        zminp, zmaxp = field_data.axial_extent
+        key = (field_data.R.shape, rminp, rmaxp, zminp, zmaxp)
+        if key != self._weights_key:
+            nz, nr = field_data.R.shape
+            fr = (np.abs(self.r_pixels) - rminp) / (rmaxp - rminp) * (nr - 1)
+            fz = (self.z_pixels - zminp) / (zmaxp - zminp) * (nz - 1)
+            self.col_mask = (fr >= -0.5) & (fr <= nr - 0.5)
+            self.row_mask = (fz >= -0.5) & (fz <= nz - 0.5)
+            fr = np.clip(fr, 0, nr - 1)
+            fz = np.clip(fz, 0, nz - 1)
+            self.r_lo = np.minimum(fr.astype(int), nr - 2)
+            self.z_lo = np.minimum(fz.astype(int), nz - 2)
+            self.wr = (fr - self.r_lo)[None, :]
+            self.wz = (fz - self.z_lo)[:, None]
+            self._weights_key = key
+        return self.z_lo, self.r_lo, self.wz, self.wr
+
+    def _colorize(self, values: np.ndarray, which: int):
+        """Map a 2D array through LUT ``which``; also return its NaN mask."""
+        vmin, vmax = self.limits[which]
+        bad = np.isnan(values)
+        if bad.any():
+            values = np.where(bad, vmin, values)
+        index = (values - vmin) * (256.0 / (vmax - vmin))
+        np.clip(index, 0, 255, out=index)
+        return self.luts[which][index.astype(np.uint8)], bad
+
+    def _draw_interface(self, frame: np.ndarray, facets) -> None:
+        segments = np.asarray(facets, dtype=float).reshape(-1, 2, 2)
+        if len(segments) == 0:
+            return
+        cols = self.c0 + (segments[..., 0] - self.config.rmin) * self.sx
+        rows = self.row0 - (segments[..., 1] - self.config.zmin) * self.sz
+        length = np.hypot(cols[:, 1] - cols[:, 0], rows[:, 1] - rows[:, 0])
+        count = np.ceil(length / 0.5).astype(int) + 1
+        owner = np.repeat(np.arange(len(segments)), count)
+        start = np.cumsum(count) - count
+        s = (np.arange(count.sum()) - np.repeat(start, count)) / np.repeat(
+            np.maximum(count - 1, 1), count
+        )
+        pc = cols[owner, 0] + s * (cols[owner, 1] - cols[owner, 0])
+        pr = rows[owner, 0] + s * (rows[owner, 1] - rows[owner, 0])
+        pr = (np.rint(pr)[:, None] + self.stencil[:, 0]).astype(int).ravel()
+        pc = (np.rint(pc)[:, None] + self.stencil[:, 1]).astype(int).ravel()
+        keep = (pr >= 0) & (pr < frame.shape[0]) & (pc >= 0) & (pc < frame.shape[1])
+        frame[pr[keep], pc[keep]] = self.interface_rgb
+
+    def _draw_title(self, frame: np.ndarray, time: float) -> None:
+        sprites = [self.prefix] + [self.glyphs[g] for g in f"{time:4.3f}" if g in self.glyphs]
+        text = np.concatenate(sprites, axis=1)
+        blit_sprite(frame, text, self.title_top, int(self.title_center - text.shape[1] / 2))
+
+    def draw(self, field_data: FieldData, facets, time: float) -> np.ndarray:
+        """Compose one frame as an ``(H, W, 3)`` uint8 array."""
+        frame = self.background.copy()
+        z_lo, r_lo, wz, wr = self._sampling(field_data)
+        rows = self.rows[self.row_mask]
+        rows = slice(rows[0], rows[-1] + 1)
+        zi = z_lo[self.row_mask][:, None]
+        wz = wz[self.row_mask]
+        for which, values in enumerate((field_data.strain_rate, field_data.velocity)):
+            half = (self.r_pixels < 0) if which == 0 else (self.r_pixels >= 0)
+            half &= self.col_mask
+            if not half.any():
+                continue
+            ri, w = r_lo[half][None, :], wr[:, half]
+            top = values[zi, ri] * (1 - w) + values[zi, ri + 1] * w
+            bottom = values[zi + 1, ri] * (1 - w) + values[zi + 1, ri + 1] * w
+            rgb, bad = self._colorize(top + wz * (bottom - top), which)
+            cols = self.cols[half]
+            block = frame[rows, cols[0]:cols[-1] + 1]
+            if bad.any():  # keep the background where the field is undefined
+                rgb[bad] = block[bad]
+            block[:] = rgb
+
+        self._draw_interface(frame, facets)
+        flat = frame.reshape(-1, 3)
+        flat[self.outline_index] = (
+            flat[self.outline_index] * (1 - self.outline_alpha)
+            + self.outline_rgb * self.outline_alpha
+        ).astype(np.uint8)
+        self._draw_title(frame, time)
+        return frame
+
+    def render(self, field_data: FieldData, facets, snapshot: SnapshotInfo) -> None:
+        """Compose the frame for ``snapshot`` and write it as PNG."""
+        matplotlib.image.imsave(snapshot.target, self.draw(field_data, facets, snapshot.time))
+
+
+_RENDERER_CACHE = {}
+
+
+RENDERERS = {"matplotlib": FrameRenderer, "raster": RasterRenderer}
+
+
+def get_renderer(config: RuntimeConfig, style: PlotStyle):
+    """
+    Return this worker process's renderer for ``config``, creating it on
+    first use. Cases sharing a pool reuse a renderer when their frame
+    geometry and colorbars match.
+    """
+    key = (
+        config.renderer, config.bounds,
+        config.d2_vmin, config.d2_vmax, config.vel_vmin, config.vel_vmax, style,
+    )
+    if key not in _RENDERER_CACHE:
+        _RENDERER_CACHE[key] = RENDERERS[config.renderer](config, style)
+    return _RENDERER_CACHE[key]
+
+
 def plot_snapshot(
     field_data: FieldData,
     facets,
-    bounds: DomainBounds,
     snapshot: SnapshotInfo,
     config: RuntimeConfig,
     style: PlotStyle,
@@ -458,101 +1108,149 @@ def plot_snapshot(
     """
     Render and persist a single snapshot figure.
 
-    #### Visualization
-    - Left side: log10(D:D) strain-rate field
-    - Right side: velocity magnitude
+    Delegates to the worker's persistent renderer for ``config`` (see
+    `get_renderer`), which takes the domain bounds from ``config.bounds``.
     """
-    fig, ax = plt.subplots()
-    fig.set_size_inches(*style.figure_size)
-
-    draw_domain_outline(ax, bounds, style)
-    line_segments = LineCollection(
-        facets, linewidths=4, colors=style.interface_color, linestyle="solid"
-    )
-    ax.add_collection(line_segments)
-
-    rminp, rmaxp = field_data.radial_extent
-    zminp, zmaxp = field_data.axial_extent
-
-    cntrl1 = ax.imshow(  # left half: strain-rate field log10(D:D)
-        field_data.strain_rate,
-        cmap="hot_r",
-        interpolation="Bilinear",
-        origin="lower",
-        extent=[-rminp, -rmaxp, zminp, zmaxp],
-        vmax=config.d2_vmax,
-        vmin=config.d2_vmin,
-    )
-
-    cntrl2 = ax.imshow(  # right half: velocity magnitude
-        field_data.velocity,
-        interpolation="Bilinear",
-        cmap="Purples",
-        origin="lower",
-        extent=[rminp, rmaxp, zminp, zmaxp],
-        vmax=config.vel_vmax,
-        vmin=config.vel_vmin,
-    )
-
-    ax.set_aspect("equal")
-    ax.set_xlim(bounds.rmin, bounds.rmax)
-    ax.set_ylim(bounds.zmin, bounds.zmax)
-    ax.set_title(f"$t/\\tau_0$ = {snapshot.time:4.3f}", fontsize=style.tick_label_size)
-    ax.axis("off")
-
-    add_colorbar(
-        fig,
-        ax,
-        cntrl1,
-        align="left",
-        label=r"$\log_{10}\left(\mu_r(\boldsymbol{\mathcal{D}:\mathcal{D}})\right)$",
-        style=style,
-    )
-    add_colorbar(
-        fig,
-        ax,
-        cntrl2,
-        align="right",
-        label=r"$\|\boldsymbol{u}\|$",
-        style=style,
-    )
-
-    plt.savefig(snapshot.target, bbox_inches="tight")
-    plt.close(fig)
+    get_renderer(config, style).render(field_data, facets, snapshot)
+
+
+def relative_path(path: str, parts: int = 3) -> str:
+    """Shorten ``path`` to its last components (CaseNo/folder/filename) for logs."""
+    pieces = path.split(os.sep)
+    return os.sep.join(pieces[-parts:]) if len(pieces) >= parts else path
 
 
-def process_timestep(index: int, config: RuntimeConfig, style: PlotStyle) -> None:
+"""
+Extraction Cache
+----------------
+Helper output depends only on the snapshot and the sampling, not on colours,
+colorbar limits or layout. With ``--cache``, each snapshot's facets, grid
+axes and float32 fields are stored as an uncompressed ``.npz`` named after
+the snapshot and a hash of everything that shapes the extraction, so
+re-rendering with a new style skips the helpers.
+"""
+EXTRACTED_FIELDS = ("z", "r", "D2", "vel")  # getData grid columns, part of the key
+CACHE_FORMAT = 2  # float32 fields on 1-D z/r axes, part of the key
+
+
+def extraction_key(snapshot: SnapshotInfo, config: RuntimeConfig) -> str:
+    """Hash of the snapshot identity (mtime, size) and the sampling settings."""
+    stat = os.stat(snapshot.source)
+    key = (
+        stat.st_mtime_ns, stat.st_size,
+        config.zmin, config.zmax, config.rmax, config.grids_per_r,
+        config.simplify, EXTRACTED_FIELDS, CACHE_FORMAT,
+    )
+    return hashlib.sha1(repr(key).encode()).hexdigest()[:16]
+
+
+def read_extraction_cache(path: str):
+    """Return ``(facets, field_data)`` from a cache file, or None if unusable."""
+    try:
+        with np.load(path) as data:
+            Z, R = np.meshgrid(data["z"], data["r"], indexing="ij")
+            return data["facets"], FieldData(
+                R=R, Z=Z,
+                strain_rate=data["D2"].astype(float), velocity=data["vel"].astype(float),
+                nz=Z.shape[0],
+            )
+    except (OSError, KeyError, ValueError):
+        return None
+
+
+def write_extraction_cache(path: str, facets, field_data: FieldData) -> None:
     """
-    Worker executed for every timestep index.
+    Store one snapshot's extraction, replacing entries with stale keys.
+
+    The sampling grid is regular, so only its axes are kept, and the fields
+    are stored as float32: a quarter of the full ``(nz, nr, 4)`` float64 grid.
+    """
+    folder, name = os.path.split(path)
+    prefix = name.rsplit(".", 2)[0] + "."  # "<snapshot>." without key and suffix
+    ensure_directory(folder)
+    temp = f"{path}.{os.getpid()}.tmp"
+    with open(temp, "wb") as fh:  # write then rename: readers never see partial files
+        np.savez(
+            fh, facets=np.asarray(facets, dtype=float),
+            z=field_data.Z[:, 0], r=field_data.R[0, :],
+            D2=field_data.strain_rate.astype(np.float32),
+            vel=field_data.velocity.astype(np.float32),
+        )
+    os.replace(temp, path)
+    for old in os.listdir(folder):
+        if old.startswith(prefix) and old.endswith(".npz") and old != name:
+            try:
+                os.remove(os.path.join(folder, old))
+            except FileNotFoundError:
+                pass
+
+
+def load_snapshot(snapshot: SnapshotInfo, config: RuntimeConfig):
+    """
+    Return ``(facets, field_data)`` for ``snapshot``, from the extraction cache
+    when it holds a matching entry, otherwise from the helper(s).
+    """
+    if not config.cache_dir:
+        return extract_snapshot(snapshot, config)
+    cache_path = os.path.join(
+        config.cache_dir.replace("{case}", config.case_dir),
+        f"{os.path.basename(snapshot.source)}.{extraction_key(snapshot, config)}.npz",
+    )
+    cached = read_extraction_cache(cache_path) if os.path.exists(cache_path) else None
+    if cached is not None:
+        log_status(f"Cached: {os.path.basename(snapshot.source)}")
+        return cached
+    facets, field_data = extract_snapshot(snapshot, config)
+    write_extraction_cache(cache_path, facets, field_data)
+    return facets, field_data
+
+
+def extract_snapshot(snapshot: SnapshotInfo, config: RuntimeConfig):
+    """Run the helper(s) for ``snapshot`` and return ``(facets, field_data)``."""
+    rel_snapshot = os.path.join("intermediate", os.path.basename(snapshot.source))  # relative path for Basilisk helpers
+    case_dir = os.path.abspath(config.case_dir)
+    nr = int(config.grids_per_r * config.rmax)
+    if config.combined_extraction:
+        return get_bundle(
+            rel_snapshot, case_dir, config.zmin, config.zmax, config.rmax,
+            nr, config.helper_mpi, config.simplify,
+        )
+    facets = get_facets(
+        rel_snapshot, case_dir, config.helper_mpi, config.simplify,
+        (config.zmin, 0.0, config.zmax, config.rmax), config.text_facets,
+    )
+    field_data = get_field(
+        rel_snapshot, case_dir, config.zmin, config.zmax, config.rmax,
+        nr, config.helper_mpi,
+    )
+    return facets, field_data
+
+
+def process_timestep(
+    snapshot: SnapshotInfo, config: RuntimeConfig, style: PlotStyle
+) -> Tuple[SnapshotInfo, bool]:
+    """
+    Worker executed for every snapshot whose frame is stale.
 
     Performs availability checks, loads helper outputs, and calls plot_snapshot.
+    Returns ``(snapshot, rendered)`` so the scheduler can account for the
+    finished work and record it in the manifest.
     """
-    snapshot = build_snapshot_info(index, config)
     if not os.path.exists(snapshot.source):
         log_status(f"Missing: {os.path.basename(snapshot.source)}", level="WARN")
-        return
-    if os.path.exists(snapshot.target):
-        log_status(f"Exists, skipping: {os.path.basename(snapshot.target)}")
-        return
+        return snapshot, False
+    if snapshot.fresh:
+        log_status(f"Up to date, skipping: {os.path.basename(snapshot.target)}")
+        return snapshot, False
 
-    src_parts = snapshot.source.split(os.sep)  # show relative path: CaseNo/intermediate/filename
-    src_rel = os.sep.join(src_parts[-3:]) if len(src_parts) >= 3 else snapshot.source
+    src_rel = relative_path(snapshot.source)
     log_status(f"Processing {src_rel}")
 
-    rel_snapshot = os.path.join("intermediate", f"snapshot-{snapshot.time:.4f}")  # relative path for Basilisk helpers
-    case_dir = os.path.abspath(config.case_dir)
-
     try:
-        facets = get_facets(rel_snapshot, case_dir)
-        nr = int(config.grids_per_r * config.rmax)
-        field_data = get_field(
-            rel_snapshot, case_dir, config.zmin, config.zmax, config.rmax, nr
-        )
-        plot_snapshot(field_data, facets, config.bounds, snapshot, config, style)
-
-        tgt_parts = snapshot.target.split(os.sep)  # show relative path: CaseNo/Video/filename
-        tgt_rel = os.sep.join(tgt_parts[-3:]) if len(tgt_parts) >= 3 else snapshot.target
-        log_status(f"Saved: {tgt_rel}")
+        facets, field_data = load_snapshot(snapshot, config)
+        plot_snapshot(field_data, facets, snapshot, config, style)
+        log_status(f"Saved: {relative_path(snapshot.target)}")
+        return snapshot, True
 
     except Exception as err:
         log_status(
@@ -561,22 +1259,54 @@ def process_timestep(index: int, config: RuntimeConfig, style: PlotStyle) -> Non
         raise
 
 
-def encode_video(config: RuntimeConfig) -> None:
+def stream_timestep(
+    snapshot: SnapshotInfo, config: RuntimeConfig, style: PlotStyle
+) -> Tuple[SnapshotInfo, Optional[np.ndarray]]:
     """
-    Run ffmpeg to stitch PNG frames into an MP4 video.
+    Streaming counterpart of `process_timestep`: return ``(snapshot, frame)``
+    instead of writing the frame.
 
-    The output video is saved in the case directory with the case number
-    as filename (e.g., simulationCases/1000/1000.mp4).
+    Missing snapshots yield a ``None`` frame. An up-to-date PNG from an
+    earlier run is read back rather than re-rendered; with ``keep_frames`` new frames are
+    also written as PNG.
     """
-    case_no = os.path.basename(config.case_dir)  # extract case number from path
-    output_path = os.path.join(config.case_dir, f"{case_no}.mp4")
-    input_pattern = os.path.join(config.output_dir, "*.png")
+    if not os.path.exists(snapshot.source):
+        log_status(f"Missing: {os.path.basename(snapshot.source)}", level="WARN")
+        return snapshot, None
+    if snapshot.fresh:
+        log_status(f"Up to date, reusing: {os.path.basename(snapshot.target)}")
+        image = matplotlib.image.imread(snapshot.target)[:, :, :3]
+        if image.dtype != np.uint8:
+            image = (image * 255 + 0.5).astype(np.uint8)
+        return snapshot, image
+
+    src_rel = relative_path(snapshot.source)
+    log_status(f"Processing {src_rel}")
+    try:
+        facets, field_data = load_snapshot(snapshot, config)
+        frame = get_renderer(config, style).draw(field_data, facets, snapshot.time)
+        if config.keep_frames:
+            matplotlib.image.imsave(snapshot.target, frame)
+        return snapshot, frame
 
-    cmd = [
-        "ffmpeg", "-y",
-        "-framerate", str(config.framerate),
-        "-pattern_type", "glob",
-        "-i", input_pattern,
+    except Exception as err:
+        log_status(
+            f"Error at {src_rel} (t={snapshot.time:.4f}): {err}", level="ERROR"
+        )
+        raise
+
+
+def video_output_path(config: RuntimeConfig) -> str:
+    """``<case>/<case>.mp4``, e.g. simulationCases/1000/1000.mp4 (montage: ``<frames>.mp4``)."""
+    if config.montage:
+        return os.path.normpath(config.output_dir) + ".mp4"
+    case_no = os.path.basename(os.path.normpath(config.case_dir))
+    return os.path.join(config.case_dir, f"{case_no}.mp4")
+
+
+def encoder_arguments(config: RuntimeConfig, output_path: str) -> list:
+    """ffmpeg output options shared by the PNG and the streaming encoders."""
+    return [
         "-vf", "pad=ceil(iw/2)*2:ceil(ih/2)*2",
         "-c:v", "libx264",
         "-r", str(config.output_fps),
@@ -584,28 +1314,830 @@ def encode_video(config: RuntimeConfig) -> None:
         output_path
     ]
 
+
+def encode_video(config: RuntimeConfig, frames: Sequence[str]) -> None:
+    """
+    Run ffmpeg to stitch the PNG ``frames`` (the planned targets, in time
+    order) into an MP4 video.
+
+    The output video is saved in the case directory with the case number
+    as filename (e.g., simulationCases/1000/1000.mp4). Only the listed
+    frames are encoded, never other PNGs of the folder (see `RenderManifest`).
+    With ``segments > 1`` the frames are split into segments encoded in
+    parallel (see `SegmentedEncoder`).
+    """
+    frames = [f for f in frames if os.path.exists(f)]
+    if not frames:
+        log_status("No frames to encode", level="WARN")
+        return
+    if config.segments > 1:
+        encoder = SegmentedEncoder(config, frames)
+        encoder.start()
+        encoder.finish()
+        return
+
+    output_path = video_output_path(config)
     log_status(f"Encoding video: {output_path}")
+    try:
+        encode_segment(
+            config, frames, output_path, 0, os.path.join(config.output_dir, "encode")
+        )
+    except RuntimeError as err:
+        log_status(str(err), level="ERROR")
+        raise
+    log_status(f"Video saved: {output_path}")
+
+
+"""
+Segmented Encoding
+------------------
+A single libx264 pass over hundreds of 1080p frames is a serial tail after
+the parallel rendering. The frames are instead split into contiguous
+segments, each encoded by its own ffmpeg (so each starts on a keyframe),
+and the segment files are joined with the concat demuxer and ``-c copy``,
+without re-encoding. Segment lengths are multiples of the input/output
+frame-rate ratio so that ``-r`` drops the same frames as a single pass.
+"""
+
+
+def encode_segment(
+    config: RuntimeConfig, frames: Sequence[str], path: str, threads: int,
+    folder: Optional[str] = None,
+) -> None:
+    """
+    Encode ``frames`` (PNG paths, in order) to the video ``path``, through
+    numbered links in the temporary ``folder`` (default: ``path`` without
+    ``.mp4``). ``threads`` 0 lets ffmpeg choose.
+    """
+    folder = folder or path[:-len(".mp4")]
+    shutil.rmtree(folder, ignore_errors=True)
+    os.makedirs(folder)
+    for k, frame in enumerate(frames):  # numbered links for the image2 demuxer
+        os.symlink(os.path.abspath(frame), os.path.join(folder, f"{k:06d}.png"))
+    cmd = [
+        "ffmpeg", "-y", "-nostats", "-loglevel", "error",
+        "-framerate", str(config.framerate),
+        "-i", os.path.join(folder, "%06d.png"),
+        "-threads", str(threads),
+    ] + encoder_arguments(config, path)
     result = sp.run(cmd, capture_output=True, text=True)
+    shutil.rmtree(folder, ignore_errors=True)
     if result.returncode != 0:
-        log_status(f"ffmpeg error: {result.stderr}", level="ERROR")
-        raise RuntimeError(f"ffmpeg failed with code {result.returncode}")
-    log_status(f"Video saved: {output_path}")
+        raise RuntimeError(f"ffmpeg failed on {os.path.basename(path)}: {result.stderr.strip()}")
+
+
+class SegmentedEncoder:
+    """
+    Encode ``items`` in ``config.segments`` contiguous segments on a thread
+    pool and concatenate them into ``<case>/<case>.mp4``.
+
+    ``items`` are PNG paths, or `SnapshotInfo`s whose targets are the frames.
+    With snapshots, `frame_done` counts down each segment's pending frames
+    and starts its encoding as soon as the last one is written, overlapping
+    with the rendering of the remaining segments; `order` queues the
+    rendering segment by segment to make that happen early.
+    """
+
+    def __init__(self, config: RuntimeConfig, items: Sequence, pending: Sequence = ()):
+        self.config = config
+        ratio = max(1, round(config.framerate / config.output_fps))
+        step = -(-len(items) // config.segments)
+        step = max(ratio, -(-step // ratio) * ratio)
+        self.chunks = [list(items[k:k + step]) for k in range(0, len(items), step)]
+        self.folder = os.path.join(config.output_dir, "segments")
+        self.paths = [os.path.join(self.folder, f"segment-{k:03d}.mp4") for k in range(len(self.chunks))]
+        self.segment_of = {}
+        for k, chunk in enumerate(self.chunks):
+            for item in chunk:
+                if isinstance(item, SnapshotInfo):
+                    self.segment_of[item.index] = k
+        self.pending = [0] * len(self.chunks)
+        for snapshot in pending:
+            self.pending[self.segment_of[snapshot.index]] += 1
+        self.threads = max(1, config.cpus // max(1, len(self.chunks)))
+        self.executor = ThreadPoolExecutor(max_workers=max(1, len(self.chunks)))
+        self.futures = {}
+
+    def order(self, snapshots: Sequence[SnapshotInfo]) -> list:
+        """Render queue: segment by segment, largest snapshot first within each."""
+        return sorted(snapshots, key=lambda s: (self.segment_of[s.index], -s.size))
+
+    def _submit(self, k: int) -> None:
+        frames = [
+            item.target if isinstance(item, SnapshotInfo) else item
+            for item in self.chunks[k]
+        ]
+        frames = [f for f in frames if os.path.exists(f)]
+        if frames:
+            log_status(f"Encoding segment {k + 1}/{len(self.chunks)} ({len(frames)} frames)")
+            self.futures[k] = self.executor.submit(
+                encode_segment, self.config, frames, self.paths[k], self.threads
+            )
+
+    def start(self) -> None:
+        """Start every segment that has nothing left to render."""
+        ensure_directory(self.folder)
+        for k, count in enumerate(self.pending):
+            if count == 0:
+                self._submit(k)
+
+    def frame_done(self, snapshot: SnapshotInfo) -> None:
+        k = self.segment_of[snapshot.index]
+        self.pending[k] -= 1
+        if self.pending[k] == 0:
+            self._submit(k)
+
+    def finish(self) -> None:
+        """Wait for the segments and concatenate them losslessly."""
+        output_path = video_output_path(self.config)
+        log_status(f"Encoding video: {output_path} ({len(self.chunks)} segments)")
+        try:
+            for k in sorted(self.futures):
+                self.futures[k].result()
+        finally:
+            self.executor.shutdown()
+        listing = os.path.join(self.folder, "segments.txt")
+        with open(listing, "w") as fh:
+            for k in sorted(self.futures):
+                fh.write(f"file '{os.path.abspath(self.paths[k])}'\n")
+        cmd = [
+            "ffmpeg", "-y", "-nostats", "-loglevel", "error",
+            "-f", "concat", "-safe", "0", "-i", listing,
+            "-c", "copy", output_path,
+        ]
+        result = sp.run(cmd, capture_output=True, text=True)
+        if result.returncode != 0:
+            log_status(f"ffmpeg error: {result.stderr}", level="ERROR")
+            raise RuntimeError(f"ffmpeg concat failed with code {result.returncode}")
+        shutil.rmtree(self.folder, ignore_errors=True)
+        log_status(f"Video saved: {output_path}")
+
+
+def encode_stream(config: RuntimeConfig, frames) -> None:
+    """
+    Encode an iterable of ``(H, W, 3)`` uint8 frames, in time order, by
+    writing them as raw RGB to the stdin of ``ffmpeg -f rawvideo``.
+
+    ffmpeg is started on the first frame, whose size fixes the video size;
+    ``None`` entries (missing snapshots) are skipped. No PNG is encoded or
+    decoded on the way, and nothing touches the disk except the video.
+    """
+    output_path = video_output_path(config)
+    encoder, size, count = None, None, 0
+    try:
+        for frame in frames:
+            if frame is None:
+                continue
+            if encoder is None:
+                size = frame.shape
+                cmd = [
+                    "ffmpeg", "-y", "-nostats", "-loglevel", "error",
+                    "-f", "rawvideo",
+                    "-pix_fmt", "rgb24",
+                    "-s", f"{size[1]}x{size[0]}",
+                    "-framerate", str(config.framerate),
+                    "-i", "-",
+                ] + encoder_arguments(config, output_path)
+                log_status(f"Streaming video: {output_path} ({size[1]}x{size[0]})")
+                encoder = sp.Popen(cmd, stdin=sp.PIPE, stdout=sp.DEVNULL, stderr=sp.PIPE)
+            if frame.shape != size:
+                raise RuntimeError(f"Frame size {frame.shape} differs from {size}")
+            encoder.stdin.write(np.ascontiguousarray(frame).tobytes())
+            count += 1
+    finally:
+        if encoder is not None:
+            encoder.stdin.close()
+            stderr = encoder.stderr.read().decode(errors="replace")
+            encoder.wait()
+
+    if encoder is None:
+        log_status("No frames to encode", level="WARN")
+        return
+    if encoder.returncode != 0:
+        log_status(f"ffmpeg error: {stderr}", level="ERROR")
+        raise RuntimeError(f"ffmpeg failed with code {encoder.returncode}")
+    log_status(f"Video saved: {output_path} ({count} frames)")
+
+
+"""
+Render Manifest
+---------------
+``<output>/manifest.json`` maps every PNG frame to the hash of its inputs:
+the snapshot identity and sampling (see `extraction_key`) plus everything
+that changes pixels (colorbar limits, renderer, `PlotStyle`). A frame is
+re-rendered exactly when it is missing or its inputs changed, so reruns
+after a partial re-simulation or a style tweak only touch affected frames.
+The video encodes the planned frames only, so frames that dropped out of
+the plan (deleted snapshots, a new ``--tsnap`` or a test run's ``--nGFS``)
+are kept for later runs but never encoded; ``--prune`` deletes them.
+"""
+MANIFEST_NAME = "manifest.json"
+FRAME_PATTERN = re.compile(r"^[0-9]+\.png$")  # see frame_name
+
+
+def render_inputs(snapshot: SnapshotInfo, config: RuntimeConfig, style: PlotStyle) -> str:
+    """Hash of the extraction key and all render settings for one frame."""
+    key = (
+        extraction_key(snapshot, config),
+        config.d2_vmin, config.d2_vmax, config.vel_vmin, config.vel_vmax,
+        config.renderer, style,
+    )
+    return hashlib.sha1(repr(key).encode()).hexdigest()[:16]
+
+
+class RenderManifest:
+    """Per-frame input hashes of one output folder, saved after every update."""
+
+    def __init__(self, output_dir: str):
+        self.path = os.path.join(output_dir, MANIFEST_NAME)
+        try:
+            with open(self.path) as fh:
+                self.frames = json.load(fh).get("frames", {})
+        except (OSError, ValueError):
+            self.frames = {}
+
+    def is_fresh(self, snapshot: SnapshotInfo) -> bool:
+        entry = self.frames.get(os.path.basename(snapshot.target), {})
+        return entry.get("inputs") == snapshot.inputs and os.path.exists(snapshot.target)
+
+    def record(self, snapshot: SnapshotInfo) -> None:
+        self.frames[os.path.basename(snapshot.target)] = {
+            "inputs": snapshot.inputs,
+            "source": os.path.basename(snapshot.source),
+            "time": snapshot.time,
+        }
+        self.save()
+
+    def prune(self, planned: Sequence[SnapshotInfo]) -> None:
+        """
+        Delete the frames and entries of the folder that are not in ``planned``.
+        An empty plan (e.g. an unreadable intermediate/) leaves the folder alone.
+        """
+        if not planned:
+            return
+        keep = {os.path.basename(s.target) for s in planned}
+        folder = os.path.dirname(self.path)
+        try:
+            names = os.listdir(folder)
+        except FileNotFoundError:
+            return
+        removed = [n for n in names if FRAME_PATTERN.match(n) and n not in keep]
+        for name in removed:
+            try:
+                os.remove(os.path.join(folder, name))
+            except FileNotFoundError:
+                pass
+        dropped = [n for n in self.frames if n not in keep]
+        for name in dropped:
+            del self.frames[name]
+        if removed:
+            log_status(f"Removed {len(removed)} frames no longer planned from {relative_path(folder)}")
+        if dropped:
+            self.save()
+
+    def save(self) -> None:
+        temp = f"{self.path}.tmp"
+        with open(temp, "w") as fh:
+            json.dump({"frames": self.frames}, fh, indent=1, sort_keys=True)
+        os.replace(temp, self.path)
+
+
+def format_duration(seconds: float) -> str:
+    """``h:mm:ss`` for progress messages."""
+    seconds = int(round(seconds))
+    return f"{seconds // 3600}:{seconds // 60 % 60:02d}:{seconds % 60:02d}"
+
+
+class FrameProgress:
+    """
+    Progress and ETA over a set of snapshots, weighted by snapshot size.
+
+    Frames are scheduled largest first, so a frame count would overestimate
+    the remaining time; the ETA instead extrapolates the elapsed time over
+    the snapshot bytes still to be processed.
+    """
+
+    def __init__(self, snapshots: Sequence[SnapshotInfo]):
+        self.total = len(snapshots)
+        self.total_cost = sum(max(s.size, 1) for s in snapshots)
+        self.count = 0
+        self.done_cost = 0
+        self.start = clock.monotonic()
+
+    def update(self, snapshot: SnapshotInfo) -> None:
+        self.count += 1
+        self.done_cost += max(snapshot.size, 1)
+        elapsed = clock.monotonic() - self.start
+        remaining = elapsed * (self.total_cost - self.done_cost) / self.done_cost
+        log_status(
+            f"Progress: {self.count}/{self.total} frames "
+            f"({100.0 * self.done_cost / self.total_cost:.0f}% of data), "
+            f"elapsed {format_duration(elapsed)}, ETA {format_duration(remaining)}"
+        )
+
+
+def windowed_imap(pool, worker, items: Sequence, window: int):
+    """
+    ``pool.imap`` with at most ``window`` tasks submitted but not yet
+    consumed, yielding results in submission order.
+
+    Stream frames are full ``(H, W, 3)`` arrays; a plain ``imap`` keeps
+    computing ahead of a slow frame or a slow ffmpeg, and every finished
+    frame waits in memory. Here a slow frame stalls submission instead.
+    """
+    queue = deque()
+    for item in items:
+        queue.append(pool.apply_async(worker, (item,)))
+        if len(queue) >= window:
+            yield queue.popleft().get()
+    while queue:
+        yield queue.popleft().get()
+
+
+def in_time_order(results, progress: FrameProgress):
+    """
+    Reorder ``(snapshot, frame)`` results arriving in completion order into
+    frames in snapshot order, holding early arrivals until their turn.
+    """
+    pending, next_index = {}, 0
+    for snapshot, frame in results:
+        progress.update(snapshot)
+        pending[snapshot.index] = frame
+        while next_index in pending:
+            yield pending.pop(next_index)
+            next_index += 1
+
+
+def plan_frames(config: RuntimeConfig, manifest: RenderManifest) -> list:
+    """
+    Discovered snapshots with their input hashes and freshness filled in;
+    with ``--prune``, frames of earlier plans that are not in this one are deleted.
+    """
+    planned = []
+    for snapshot in discover_snapshots(config):
+        snapshot = replace(snapshot, inputs=render_inputs(snapshot, config, PLOT_STYLE))
+        planned.append(replace(snapshot, fresh=manifest.is_fresh(snapshot)))
+    if config.prune:
+        manifest.prune(planned)
+    return planned
+
+
+def render_frames(
+    pool, snapshots, config: RuntimeConfig, manifest: RenderManifest,
+    encoder: Optional[SegmentedEncoder] = None, keep_going: bool = False,
+) -> int:
+    """
+    Render ``snapshots`` as PNG frames on ``pool``, largest snapshot first,
+    one frame per task. Returns the number of frames written.
+
+    Late frames (drops, refined meshes) cost several times the early ones,
+    so handing out single frames to whichever worker is free keeps every
+    CPU busy until the end, where static chunks would leave most idle.
+    With an ``encoder``, frames are queued segment by segment and each
+    finished frame is reported to it. A failed frame raises, unless
+    ``keep_going``: then it is logged and left stale (unrecorded).
+    """
+    progress = FrameProgress(snapshots)
+    if encoder is not None:
+        ordered = encoder.order(snapshots)
+    else:
+        ordered = sorted(snapshots, key=lambda s: s.size, reverse=True)
+    worker = partial(process_case_task, style=PLOT_STYLE)
+    tasks = [(config, s) for s in ordered]
+    count = 0
+    for _, snapshot, rendered, error in pool.imap_unordered(worker, tasks, chunksize=1):
+        if error is not None and not keep_going:
+            raise RuntimeError(f"{relative_path(snapshot.source)}: {error}")
+        if error is not None:
+            log_status(f"Frame left stale, retried later: {relative_path(snapshot.target)}", level="WARN")
+        elif rendered:
+            manifest.record(snapshot)
+            count += 1
+        progress.update(snapshot)
+        if encoder is not None:
+            encoder.frame_done(snapshot)
+    return count
+
+
+"""
+Watch Mode
+----------
+Post-processing that overlaps with the simulation: ``intermediate/`` is
+polled every ``--poll-interval`` seconds and each new snapshot is rendered
+once complete. Basilisk's ``dump()`` writes ``<name>~`` and renames it, so a
+matching name is normally complete already; as a safeguard a snapshot is
+only taken once a later one exists or its size is unchanged over one poll.
+After every batch, ``<case>/<case>-preview.mp4`` (the latest
+``--preview-frames`` frames) and ``<case>/metrics.png`` (from the in-situ
+``metrics`` table of burstingBubble.c) are refreshed. A frame that fails
+(e.g. a snapshot unreadable for one poll) is logged and retried on the
+next poll; the watch goes on.
+"""
+
+
+def settled_snapshots(snapshots: Sequence[SnapshotInfo], sizes: dict) -> list:
+    """Snapshots safe to read: followed by a later one, or of unchanged size."""
+    ready = []
+    for k, snapshot in enumerate(snapshots):
+        if k + 1 < len(snapshots) or sizes.get(snapshot.source) == snapshot.size:
+            ready.append(snapshot)
+        sizes[snapshot.source] = snapshot.size
+    return ready
+
+
+def encode_preview(config: RuntimeConfig, frames: Sequence[str]) -> None:
+    """Encode the given PNG frames to ``<case>/<case>-preview.mp4``."""
+    if not frames:
+        return
+    final = video_output_path(config)[:-len(".mp4")] + "-preview.mp4"
+    temp = final[:-len(".mp4")] + ".tmp.mp4"
+    listing = os.path.join(config.output_dir, "preview.txt")
+    with open(listing, "w") as fh:
+        for frame in frames:
+            fh.write(f"file '{os.path.abspath(frame)}'\nduration {1.0 / config.framerate}\n")
+    cmd = [
+        "ffmpeg", "-y", "-nostats", "-loglevel", "error",
+        "-f", "concat", "-safe", "0", "-i", listing,
+    ] + encoder_arguments(config, temp)
+    result = sp.run(cmd, capture_output=True, text=True)
+    if result.returncode != 0:
+        log_status(f"Preview encoding failed: {result.stderr.strip()}", level="WARN")
+        return
+    os.replace(temp, final)  # players never see a half-written preview
+    log_status(f"Preview updated: {relative_path(final)} ({len(frames)} frames)")
+
+
+def plot_metrics(config: RuntimeConfig) -> None:
+    """Plot the in-situ ``metrics`` table, if the case writes one, to ``metrics.png``."""
+    source = os.path.join(config.case_dir, "metrics")
+    if not os.path.exists(source):
+        return
+    try:  # the simulation may be appending a row right now
+        table = np.genfromtxt(source, names=True, invalid_raise=False)
+    except ValueError:
+        return
+    if table.size < 2:
+        return
+    panels = (
+        ("x_tip", r"$x_{tip}$"), ("u_tip", r"$u_{tip}$"),
+        ("r_neck", r"$r_{neck}$"), ("n_drops", r"$n_{drops}$"),
+    )
+    fig, axes = plt.subplots(2, 2, figsize=(10, 6), sharex=True)
+    for ax, (column, label) in zip(axes.flat, panels):
+        ax.plot(table["t"], table[column], color="black", lw=1.5, marker=".", ms=3)
+        ax.set_ylabel(label)
+    for ax in axes[1]:
+        ax.set_xlabel(r"$t/\tau_0$")
+    fig.tight_layout()
+    fig.savefig(os.path.join(config.case_dir, "metrics.png"), dpi=100)
+    plt.close(fig)
+
+
+def watch(config: RuntimeConfig) -> None:
+    """Render snapshots as they appear until interrupted or idle too long."""
+    manifest = RenderManifest(config.output_dir)
+    sizes, last_new = {}, clock.monotonic()
+    log_status(f"Watching {os.path.join(config.case_dir, 'intermediate')} (Ctrl-C to stop)")
+    with mp.Pool(processes=config.cpus) as pool:
+        try:
+            snapshots = []
+            while True:
+                snapshots = plan_frames(config, manifest)
+                stale = [s for s in settled_snapshots(snapshots, sizes) if not s.fresh]
+                if stale and render_frames(pool, stale, config, manifest, keep_going=True):
+                    last_new = clock.monotonic()
+                    done = [s.target for s in snapshots if os.path.exists(s.target)]
+                    encode_preview(config, done[-config.preview_frames:])
+                    plot_metrics(config)
+                elif config.idle_timeout > 0 and clock.monotonic() - last_new > config.idle_timeout:
+                    log_status(f"No new snapshots for {config.idle_timeout:g} s, stopping")
+                    break
+                clock.sleep(config.poll_interval)
+        except KeyboardInterrupt:
+            log_status("Watch interrupted")
+
+    if not config.skip_video_encode:  # the full video once the run is over
+        encode_video(config, [s.target for s in snapshots])
+
+
+"""
+Shared Pool Across Cases
+------------------------
+With ``--case`` given several times, every stale (case, snapshot) frame of
+all cases goes into one worker pool, so a sweep keeps all CPUs busy instead
+of running one under-filled pool per case. Tasks are queued case by case,
+largest snapshot first within a case: earlier cases complete early and
+their video encoding, a dependent task started as soon as a case's last
+frame is done, overlaps with the rendering of later cases.
+"""
+
+
+def process_case_task(task, style: PlotStyle):
+    """
+    Pool worker for one ``(config, snapshot)`` task of `render_frames`,
+    e.g. in a multi-case run.
+
+    Errors are returned instead of raised, so a failing case does not stop
+    the others: ``(case_dir, snapshot, rendered, error)``.
+    """
+    config, snapshot = task
+    try:
+        snapshot, rendered = process_timestep(snapshot, config, style)
+        return config.case_dir, snapshot, rendered, None
+    except Exception as err:
+        return config.case_dir, snapshot, False, str(err)
+
+
+def case_configs(config: RuntimeConfig) -> dict:
+    """
+    One single-case config per ``config.cases`` entry, keyed by case folder.
+
+    Each case renders to ``<case>/Video`` with its own Z bounds and
+    extraction cache; an explicit cache folder without ``{case}`` gets one
+    subfolder per case, so cases never evict each other's entries.
+    """
+    cache_dir = config.cache_dir
+    if cache_dir and "{case}" not in cache_dir:
+        cache_dir = os.path.join(cache_dir, "{case_name}")
+    configs = {}
+    for case_dir, zmin, zmax in config.cases:
+        configs[case_dir] = replace(
+            config, case_dir=case_dir, output_dir=os.path.join(case_dir, "Video"),
+            zmin=zmin, zmax=zmax, cases=(), montage=False,
+            cache_dir=cache_dir.replace("{case_name}", os.path.basename(os.path.normpath(case_dir))),
+        )
+    return configs
+
+
+def run_cases(config: RuntimeConfig) -> int:
+    """Render and encode all ``config.cases`` on one pool; returns the number of failed cases."""
+    configs = case_configs(config)
+    manifests, plans, pending, failed, tasks = {}, {}, {}, {}, []
+    for case_dir, case_config in configs.items():
+        ensure_directory(case_config.output_dir)
+        manifests[case_dir] = RenderManifest(case_config.output_dir)
+        snapshots = plan_frames(case_config, manifests[case_dir])
+        plans[case_dir] = [s.target for s in snapshots]
+        stale = [s for s in snapshots if not s.fresh]
+        log_status(
+            f"{relative_path(case_dir, 1)}: {len(snapshots)} snapshots, "
+            f"{len(stale)} to render, Z=[{case_config.zmin:.2f},{case_config.zmax:.2f}]"
+        )
+        if not snapshots:
+            failed[case_dir] = "no snapshots"
+            continue
+        pending[case_dir] = len(stale)
+        tasks += [(case_config, s) for s in sorted(stale, key=lambda s: s.size, reverse=True)]
+
+    log_status(f"Shared pool: {len(tasks)} frames from {len(configs)} cases on {config.cpus} CPUs")
+    progress = FrameProgress([s for _, s in tasks])
+    encodes = {}
+    with ThreadPoolExecutor(max_workers=2) as encoder:
+        def case_done(case_dir: str) -> None:
+            if not config.skip_video_encode and case_dir not in failed:
+                encodes[case_dir] = encoder.submit(encode_video, configs[case_dir], plans[case_dir])
+
+        for case_dir in [d for d, n in pending.items() if n == 0]:
+            case_done(case_dir)
+        with mp.Pool(processes=config.cpus) as pool:
+            worker = partial(process_case_task, style=PLOT_STYLE)
+            for case_dir, snapshot, rendered, error in pool.imap_unordered(worker, tasks, chunksize=1):
+                progress.update(snapshot)
+                if error is not None:
+                    failed.setdefault(case_dir, error)
+                elif rendered:
+                    manifests[case_dir].record(snapshot)
+                pending[case_dir] -= 1
+                if pending[case_dir] == 0:
+                    case_done(case_dir)
+
+        for case_dir, future in encodes.items():
+            try:
+                future.result()
+            except Exception as err:
+                failed[case_dir] = f"encoding: {err}"
+
+    for case_dir, reason in failed.items():
+        log_status(f"{relative_path(case_dir, 1)} failed: {reason}", level="ERROR")
+    log_status(f"Shared pool done: {len(configs) - len(failed)}/{len(configs)} cases succeeded")
+    return len(failed)
+
+
+"""
+Montage
+-------
+``--montage`` with several ``--case`` renders one video of all cases side
+by side, e.g. to compare the Oh values of a sweep. Montage times are the
+union of the cases' snapshot times, thinned by ``--tsnap``; each panel shows
+its case's latest snapshot not after that time, so cases with sparser or
+shifted output hold their previous frame, and each panel title shows the
+time actually drawn. A case that has not started is a blank panel, and one
+that ended keeps its last frame, labelled as such. Panels are ordinary
+frames at a reduced ``PlotStyle.dpi`` (so fonts scale with them), loaded
+through the per-case extraction cache (a scratch one without ``--cache``,
+see `run_montage`), and tiled on a near-square grid.
+"""
+
+
+@dataclass(frozen=True)
+class MontageFrame:
+    """One montage frame; the scheduling fields mirror `SnapshotInfo`."""
+
+    index: int
+    time: float
+    target: str
+    panels: Tuple[Tuple[RuntimeConfig, Optional[SnapshotInfo], str], ...]  # (case, snapshot, note)
+    source: str = "montage"
+    size: int = 0
+    inputs: str = ""
+    fresh: bool = False
+
+
+def montage_grid(count: int) -> Tuple[int, int]:
+    """``(rows, cols)`` of the near-square panel grid."""
+    cols = int(np.ceil(np.sqrt(count)))
+    return int(np.ceil(count / cols)), cols
+
+
+def montage_style(config: RuntimeConfig) -> PlotStyle:
+    """`PLOT_STYLE` at the dpi that fits ``cols`` panels in ``montage_width``."""
+    _, cols = montage_grid(len(config.cases))
+    dpi = max(10, int(config.montage_width / cols / PLOT_STYLE.figure_size[0]))
+    return replace(PLOT_STYLE, dpi=dpi)
+
+
+def plan_montage(config: RuntimeConfig, manifest: RenderManifest) -> list:
+    """Matched-time montage frames over all cases, with inputs and freshness."""
+    configs = list(case_configs(config).values())
+    style = montage_style(config)
+    series = [discover_snapshots(replace(c, tsnap=0.0, n_snapshots=0)) for c in configs]
+    times = sorted({s.time for snapshots in series for s in snapshots})
+
+    kept = []
+    for time in times:
+        if kept and time < kept[-1] + config.tsnap * (1 - 1e-6):
+            continue
+        if config.n_snapshots > 0 and len(kept) == config.n_snapshots:
+            break
+        kept.append(time)
+
+    frames = []
+    for index, time in enumerate(kept):
+        panels, keys, size = [], [], 0
+        for case_config, snapshots in zip(configs, series):
+            shown = [s for s in snapshots if s.time <= time + 1e-9]
+            snapshot = shown[-1] if shown else None
+            note = "" if snapshots and time <= snapshots[-1].time + 1e-9 else "ended"
+            if snapshot is None:
+                note = "no data"
+            panels.append((case_config, snapshot, note))
+            keys.append((note, render_inputs(snapshot, case_config, style) if snapshot else None))
+            size += snapshot.size if snapshot else 0
+        target = os.path.join(config.output_dir, frame_name(time))
+        inputs = hashlib.sha1(repr((keys, style, config.montage_width)).encode()).hexdigest()[:16]
+        frame = MontageFrame(index, time, target, tuple(panels), size=size, inputs=inputs)
+        frames.append(replace(frame, fresh=manifest.is_fresh(frame)))
+    if config.prune:
+        manifest.prune(frames)
+    return frames
+
+
+_LABEL_CACHE = {}
+
+
+def panel_label(text: str, style: PlotStyle) -> np.ndarray:
+    """Case label sprite for a montage panel, cached per worker."""
+    key = (text, style.dpi)
+    if key not in _LABEL_CACHE:
+        height = int(style.tick_label_size * 2.5 * style.dpi / 72)
+        _LABEL_CACHE[key] = render_text_sprite(text, style.tick_label_size, style.dpi, height)
+    return _LABEL_CACHE[key]
+
+
+def process_montage_frame(frame: MontageFrame, style: PlotStyle) -> Tuple[MontageFrame, bool]:
+    """Render every panel of ``frame``, tile them and write the PNG."""
+    rows, cols = montage_grid(len(frame.panels))
+    height, width = get_renderer(frame.panels[0][0], style).shape
+    canvas = np.full((rows * height, cols * width, 3), 255, dtype=np.uint8)
+    log_status(f"Montage t={frame.time:.4f}")
+    for k, (case_config, snapshot, note) in enumerate(frame.panels):
+        top, left = (k // cols) * height, (k % cols) * width
+        panel = canvas[top:top + height, left:left + width]
+        if snapshot is not None:
+            try:
+                facets, field_data = load_snapshot(snapshot, case_config)
+            except Exception as err:
+                log_status(
+                    f"Error at {relative_path(snapshot.source)} (t={snapshot.time:.4f}): {err}",
+                    level="ERROR",
+                )
+                raise
+            panel[:] = get_renderer(case_config, style).draw(field_data, facets, snapshot.time)
+        name = os.path.basename(os.path.normpath(case_config.case_dir))
+        blit_sprite(panel, panel_label(f"{name} ({note})" if note else name, style), 0, 0)
+    matplotlib.image.imsave(frame.target, canvas)
+    return frame, True
+
+
+def run_montage(config: RuntimeConfig) -> None:
+    """
+    Render the montage frames on one pool and encode the comparison video.
+
+    Panels repeat a snapshot while its case holds or has ended, so panels
+    always go through an extraction cache: the ``--cache`` one, or else a
+    scratch cache in the montage folder that is removed afterwards. Frames
+    are queued in time order, so a held snapshot is normally cached by the
+    time later frames need it, and each (case, snapshot) is extracted once.
+    """
+    ensure_directory(config.output_dir)
+    scratch = "" if config.cache_dir else os.path.join(config.output_dir, "panel-cache")
+    if scratch:
+        config = replace(config, cache_dir=scratch)
+    try:
+        render_montage(config)
+    finally:
+        if scratch:
+            shutil.rmtree(scratch, ignore_errors=True)
+
+
+def render_montage(config: RuntimeConfig) -> None:
+    """Plan, render and encode the montage frames of ``config``."""
+    manifest = RenderManifest(config.output_dir)
+    frames = plan_montage(config, manifest)
+    if not frames:
+        log_status("No snapshots to process", level="WARN")
+        return
+    stale = [f for f in frames if not f.fresh]
+    log_status(
+        f"Montage of {len(config.cases)} cases: {len(frames)} frames, "
+        f"t=[{frames[0].time:.4f}, {frames[-1].time:.4f}], {len(stale)} to render"
+    )
+    progress = FrameProgress(stale)
+    with mp.Pool(processes=config.cpus) as pool:
+        worker = partial(process_montage_frame, style=montage_style(config))
+        for frame, rendered in pool.imap_unordered(worker, stale, chunksize=1):
+            if rendered:
+                manifest.record(frame)
+            progress.update(frame)
+
+    if not config.skip_video_encode:
+        encode_video(config, [f.target for f in frames])
 
 
 def main():
     """Entry point for CLI invocation."""
     config = parse_arguments()
+    if config.montage:
+        run_montage(config)
+        return
+    if config.cases:
+        raise SystemExit(1 if run_cases(config) else 0)
     ensure_directory(config.output_dir)
 
     log_status(f"Processing case: {config.case_dir}")
     log_status(f"Domain: R=[{config.rmin:.2f},{config.rmax:.2f}], Z=[{config.zmin:.2f},{config.zmax:.2f}]")
 
+    if config.watch:
+        watch(config)
+        return
+
+    manifest = RenderManifest(config.output_dir)
+    snapshots = plan_frames(config, manifest)
+    if not snapshots:
+        log_status("No snapshots to process", level="WARN")
+        return
+    log_status(
+        f"Found {len(snapshots)} snapshots, t=[{snapshots[0].time:.4f}, {snapshots[-1].time:.4f}]"
+    )
+    stale = [s for s in snapshots if not s.fresh]
+    log_status(f"{len(snapshots) - len(stale)} frames up to date, {len(stale)} to render")
+
+    if config.stream:  # time order for ffmpeg, at most 2 x CPUs frames in flight
+        def recorded(results):
+            for snapshot, frame in results:
+                if config.keep_frames and frame is not None and not snapshot.fresh:
+                    manifest.record(snapshot)
+                yield snapshot, frame
+
+        with mp.Pool(processes=config.cpus) as pool:
+            worker = partial(stream_timestep, config=config, style=PLOT_STYLE)
+            results = windowed_imap(pool, worker, snapshots, 2 * config.cpus)
+            encode_stream(config, in_time_order(recorded(results), FrameProgress(snapshots)))
+        return
+
+    if config.segments > 1 and not config.skip_video_encode:
+        encoder = SegmentedEncoder(config, snapshots, pending=stale)
+        encoder.start()
+        with mp.Pool(processes=config.cpus) as pool:
+            render_frames(pool, stale, config, manifest, encoder)
+        encoder.finish()
+        return
+
     with mp.Pool(processes=config.cpus) as pool:
-        worker = partial(process_timestep, config=config, style=PLOT_STYLE)
-        pool.map(worker, range(config.n_snapshots))
+        render_frames(pool, stale, config, manifest)
 
     if not config.skip_video_encode:  # encode video unless skipped
-        encode_video(config)
+        encode_video(config, [s.target for s in snapshots])
 
 
 if __name__ == "__main__":
@@ -14,6 +14,13 @@ both axisymmetric and 2D Cartesian geometries.
 
 ```
 ./getData <filename> <xmin> <ymin> <xmax> <ymax> <ny>
+./getData --pyramid <dir> [--tile N] <filename> <xmin> <ymin> <xmax> <ymax>
+./getData --cells <file> <filename> <xmin> <ymin> <xmax> <ymax>
+./getData --benchmark <repeats> <filename>
+./getData --line <polyline> [--samples-per-cell N] [--out <file>] \
+          <filename> [<filename> ...]
+./getData --bundle <file> [--diagnostics] [--simplify EPS] \
+          <filename> <xmin> <ymin> <xmax> <ymax> <ny>
 ```
 
 Where:
@@ -22,6 +29,28 @@ Where:
 - `xmax`, `ymax`: Upper bounds of the sampling domain
 - `ny`: Number of grid points in y-direction (nx computed automatically)
 
+Options (must precede the positional arguments):
+- `--pyramid <dir>`: Write a multi-resolution tile pyramid into `dir`
+  instead of the uniform grid (see [Multi-Resolution
+  Pyramid](#multi-resolution-pyramid))
+- `--tile N`: Tile edge length in pixels for `--pyramid` (default: 256)
+- `--cells <file>`: Write the leaf cells inside the box at native
+  resolution instead of resampling (see [Adaptive-Mesh Cell
+  List](#adaptive-mesh-cell-list)); `-` writes to stdout
+- `--benchmark <repeats>`: Time the vectorized strain-rate kernel against
+  the scalar reference on the snapshot and report the maximum deviation
+- `--line <polyline>`: Sample along the polyline whose vertices are listed
+  in a `x y` text file (see [Line Extraction](#line-extraction)); accepts
+  several snapshots in one call
+- `--samples-per-cell N`: Samples per traversed cell for `--line`
+  (default: 4)
+- `--out <file>`: Output file for `--line` (default: stdout)
+- `--bundle <file>`: Restore once and write interface facets, the sampled
+  grid and (with `--diagnostics`) scalar diagnostics as one binary bundle
+  (see [Combined Bundle](#combined-bundle)); `-` writes to stdout
+- `--simplify EPS`: Douglas-Peucker simplify the bundle facets to a
+  maximum deviation `EPS` (physical units), as `getFacet --simplify`
+
 ## Geometry Configuration
 
 Set `AXI=1` for axisymmetric (default) or `AXI=0` for 2D Cartesian:
@@ -32,6 +61,27 @@ To change geometry:
 - Method 1: Edit `#define AXI 1` below to `#define AXI 0`
 - Method 2: Compile with flag: `qcc -DAXI=0 ...`
 
+## MPI Build
+
+For snapshots too large for one core, build and run with MPI:
+
+```
+CC99='mpicc -std=c99 -D_GNU_SOURCE=1' qcc -D_MPI=1 -O3 -fno-trapping-math \
+  -Wall -disable-dimensions -I../src-local getData.c -o getData -lm
+mpirun -np 8 ./getData <filename> <xmin> <ymin> <xmax> <ymax> <ny>
+```
+
+`restore` distributes the tree over the ranks and every derived field is
+computed on locally owned cells only. Grid sampling locates each point in
+the local leaves, fills the rest with `nodata` and combines the ranks with
+an `MPI_Reduce(MPI_MIN)` onto rank 0, which alone writes the output (the
+same scheme as Basilisk's `output_field`). `--cells` writes its array
+collectively with MPI-IO, each rank at the offset given by an exclusive
+prefix sum of the leaf counts; `-` (stdout) is not available there.
+`--pyramid` tiles are min-reduced onto rank 0 like the grid, and `--line`
+relies on the `foreach_point()`/`interpolate()` reductions so that every
+rank walks the same cells while rank 0 writes.
+
 ## Workflow
 
 1. Parse CLI bounds/grid spacing into `extraction_config`
@@ -40,6 +90,13 @@ To change geometry:
 4. Compute fields and interpolate onto regular grid
 5. Stream `x y field0 field1 ...` rows to stderr
 
+With `--pyramid`, steps 4-5 are replaced by restricting the fields onto
+every tree level and writing one set of tiles per level. With `--cells`,
+they are replaced by dumping the leaf cells themselves, and with `--line`
+by walking the polyline cell by cell for each listed snapshot. With
+`--bundle`, the grid and the facets of the same restored snapshot are
+written together in binary.
+
 ## Adding New Fields
 
 To add a new derived quantity (e.g., `Aij`):
@@ -52,8 +109,15 @@ Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
 Affiliation: CoMPhy Lab, Durham University
 */
 
+#include <errno.h>
+#include <float.h>
+#include <sys/stat.h>
 #include "utils.h"
 #include "output.h"
+#include "fractions.h"
+#include "npy-output.h"
+#include "facet-list.h"
+#include "point-list.h"
 
 #ifndef AXI
 #define AXI 1
@@ -65,16 +129,36 @@ vector u[];
 /**
 ## Data Structures
 */
+typedef enum {
+  MODE_GRID,
+  MODE_PYRAMID,
+  MODE_CELLS,
+  MODE_BENCHMARK,
+  MODE_LINE,
+  MODE_BUNDLE
+} extraction_mode;
+
 typedef struct {
   char filename[4096];
+  char output[4096];
+  char polyline[4096];
+  char const **snapshots;
+  int nsnapshots;
+  extraction_mode mode;
   double xmin, ymin, xmax, ymax;
   double Deltax, Deltay;
   int nx, ny;
+  int tile;
+  int repeats;
+  int samples_per_cell;
+  int diagnostics;
+  double simplify;
 } extraction_config;
 
 scalar D2c[], vel[];
 scalar * field_list = NULL;
 
+static void print_usage(const char *program);
 static int parse_arguments(int argc, char const *argv[],
                            extraction_config *cfg);
 static int configure_grid(extraction_config *cfg);
@@ -87,7 +171,14 @@ static void sample_fields(const extraction_config *cfg, double **field_buffer,
 static void write_fields(const extraction_config *cfg, double **field_buffer,
                          int field_count, FILE *fp);
 static void cleanup_output(FILE *fp, double **field_buffer);
+static int write_bundle(const extraction_config *cfg, double **field_buffer,
+                        int field_count);
+static int write_pyramid(const extraction_config *cfg);
+static int write_cells(const extraction_config *cfg);
+static int write_lines(const extraction_config *cfg);
 static void compute_D2c_field(scalar target);
+static void compute_D2c_field_reference(scalar target);
+static void benchmark_D2c(int repeats);
 static void compute_velocity_field(scalar target);
 
 /**
@@ -103,18 +194,40 @@ int main(int a, char const *arguments[])
   if (!parse_arguments(a, arguments, &cfg))
     return 1;
 
-  if (!configure_grid(&cfg))
+  if ((cfg.mode == MODE_GRID || cfg.mode == MODE_BUNDLE) &&
+      !configure_grid(&cfg))
     return 1;
 
   register_fields();
+
+  if (cfg.mode == MODE_LINE)
+    return write_lines(&cfg) ? 0 : 1;
+
   restore (file = cfg.filename);
+
+  if (cfg.mode == MODE_BENCHMARK) {
+    benchmark_D2c(cfg.repeats);
+    return 0;
+  }
+
   compute_fields();
 
+  if (cfg.mode == MODE_PYRAMID)
+    return write_pyramid(&cfg) ? 0 : 1;
+  if (cfg.mode == MODE_CELLS)
+    return write_cells(&cfg) ? 0 : 1;
+
   int registered_fields = list_len(field_list);
   double ** field =
     allocate_field_buffer(&cfg, registered_fields);
   sample_fields(&cfg, field, registered_fields);
 
+  if (cfg.mode == MODE_BUNDLE) {
+    int ok = write_bundle(&cfg, field, registered_fields);
+    matrix_free (field);
+    return ok ? 0 : 1;
+  }
+
   FILE * fp = ferr;
   write_fields(&cfg, field, registered_fields, fp);
   cleanup_output(fp, field);
@@ -123,31 +236,135 @@ int main(int a, char const *arguments[])
 /**
 ## Argument Parsing
 
-Read CLI arguments and guard against invalid bounds/grid sizes.
+Read leading `--options`, then the positional arguments, and guard against
+invalid bounds/grid sizes.
 */
+static void print_usage(const char *program)
+{
+  fprintf(stderr,
+          "Usage: %s <filename> <xmin> <ymin> <xmax> <ymax> <ny>\n"
+          "       %s --pyramid <dir> [--tile N] "
+          "<filename> <xmin> <ymin> <xmax> <ymax>\n"
+          "       %s --cells <file> "
+          "<filename> <xmin> <ymin> <xmax> <ymax>\n"
+          "       %s --benchmark <repeats> <filename>\n"
+          "       %s --line <polyline> [--samples-per-cell N] "
+          "[--out <file>] <filename> [<filename> ...]\n"
+          "       %s --bundle <file> [--diagnostics] [--simplify EPS] "
+          "<filename> <xmin> <ymin> <xmax> <ymax> <ny>\n",
+          program, program, program, program, program, program);
+}
+
 static int parse_arguments(int argc, char const *argv[],
                            extraction_config *cfg)
 {
-  if (argc != 7) {
-    fprintf(stderr, "Error: Expected 6 arguments\n");
-    fprintf(stderr,
-            "Usage: %s <filename> <xmin> <ymin> "
-            "<xmax> <ymax> <ny>\n", argv[0]);
+  cfg->mode = MODE_GRID;
+  cfg->output[0] = '\0';
+  cfg->tile = 256;
+  cfg->repeats = 0;
+  cfg->samples_per_cell = 4;
+  cfg->diagnostics = 0;
+  cfg->simplify = 0.;
+  cfg->polyline[0] = '\0';
+  cfg->snapshots = NULL;
+  cfg->nsnapshots = 0;
+  cfg->ny = 0;
+
+  int argi = 1;
+  while (argi < argc && !strncmp(argv[argi], "--", 2)) {
+    if (!strcmp(argv[argi], "--diagnostics")) {
+      cfg->diagnostics = 1;
+      argi++;
+      continue;
+    }
+    if (argi + 1 >= argc) {
+      fprintf(stderr, "Error: Option %s expects a value\n", argv[argi]);
+      return 0;
+    }
+    if (!strcmp(argv[argi], "--pyramid")) {
+      cfg->mode = MODE_PYRAMID;
+      snprintf(cfg->output, sizeof(cfg->output), "%s", argv[argi + 1]);
+    }
+    else if (!strcmp(argv[argi], "--tile"))
+      cfg->tile = atoi(argv[argi + 1]);
+    else if (!strcmp(argv[argi], "--cells")) {
+      cfg->mode = MODE_CELLS;
+      snprintf(cfg->output, sizeof(cfg->output), "%s", argv[argi + 1]);
+    }
+    else if (!strcmp(argv[argi], "--benchmark")) {
+      cfg->mode = MODE_BENCHMARK;
+      cfg->repeats = atoi(argv[argi + 1]);
+    }
+    else if (!strcmp(argv[argi], "--line")) {
+      cfg->mode = MODE_LINE;
+      snprintf(cfg->polyline, sizeof(cfg->polyline), "%s", argv[argi + 1]);
+    }
+    else if (!strcmp(argv[argi], "--samples-per-cell"))
+      cfg->samples_per_cell = atoi(argv[argi + 1]);
+    else if (!strcmp(argv[argi], "--out"))
+      snprintf(cfg->output, sizeof(cfg->output), "%s", argv[argi + 1]);
+    else if (!strcmp(argv[argi], "--bundle")) {
+      cfg->mode = MODE_BUNDLE;
+      snprintf(cfg->output, sizeof(cfg->output), "%s", argv[argi + 1]);
+    }
+    else if (!strcmp(argv[argi], "--simplify"))
+      cfg->simplify = atof(argv[argi + 1]);
+    else {
+      fprintf(stderr, "Error: Unknown option %s\n", argv[argi]);
+      print_usage(argv[0]);
+      return 0;
+    }
+    argi += 2;
+  }
+
+  if (cfg->mode == MODE_LINE) {
+    if (argi >= argc) {
+      fprintf(stderr, "Error: Expected at least one snapshot\n");
+      print_usage(argv[0]);
+      return 0;
+    }
+    if (cfg->samples_per_cell <= 0) {
+      fprintf(stderr, "Error: samples-per-cell must be positive.\n");
+      return 0;
+    }
+    cfg->snapshots = argv + argi;
+    cfg->nsnapshots = argc - argi;
+    return 1;
+  }
+
+  int expected = cfg->mode == MODE_GRID || cfg->mode == MODE_BUNDLE ? 6 :
+                 cfg->mode == MODE_BENCHMARK ? 1 : 5;
+  if (argc - argi != expected) {
+    fprintf(stderr, "Error: Expected %d positional arguments\n", expected);
+    print_usage(argv[0]);
     return 0;
   }
 
-  snprintf(cfg->filename, sizeof(cfg->filename), "%s", argv[1]);
-  cfg->xmin = atof(argv[2]);
-  cfg->ymin = atof(argv[3]);
-  cfg->xmax = atof(argv[4]);
-  cfg->ymax = atof(argv[5]);
-  cfg->ny = atoi(argv[6]);
+  snprintf(cfg->filename, sizeof(cfg->filename), "%s", argv[argi]);
+  if (cfg->mode == MODE_BENCHMARK) {
+    if (cfg->repeats <= 0) {
+      fprintf(stderr, "Error: repeats must be positive.\n");
+      return 0;
+    }
+    return 1;
+  }
+  cfg->xmin = atof(argv[argi + 1]);
+  cfg->ymin = atof(argv[argi + 2]);
+  cfg->xmax = atof(argv[argi + 3]);
+  cfg->ymax = atof(argv[argi + 4]);
+  if (expected == 6)
+    cfg->ny = atoi(argv[argi + 5]);
 
-  if (cfg->ny <= 0) {
+  if (expected == 6 && cfg->ny <= 0) {
     fprintf(stderr, "Error: ny must be positive.\n");
     return 0;
   }
 
+  if (cfg->mode == MODE_PYRAMID && cfg->tile <= 0) {
+    fprintf(stderr, "Error: tile must be positive.\n");
+    return 0;
+  }
+
   if (cfg->xmax <= cfg->xmin || cfg->ymax <= cfg->ymin) {
     fprintf(stderr, "Error: Bounds must satisfy xmax>xmin "
                     "and ymax>ymin.\n");
@@ -192,12 +409,15 @@ static void register_fields(void)
 /**
 ## Field Computation
 
-Dispatch compute callbacks for each registered field.
+Dispatch compute callbacks for each registered field. The callbacks fill
+leaves in plain `foreach` loops, so the ghost values at refinement, axis
+and rank boundaries are refreshed here, before any sampling reads them.
 */
 static void compute_fields(void)
 {
   compute_D2c_field(D2c);
   compute_velocity_field(vel);
+  boundary(field_list);
 }
 
 static double ** allocate_field_buffer(const extraction_config *cfg,
@@ -213,6 +433,10 @@ static double ** allocate_field_buffer(const extraction_config *cfg,
 Interpolate every registered scalar on the regular grid.
 The matrix layout follows Basilisk's `matrix_new`: row-major on i (x),
 with contiguous blocks of `registered_fields` entries per (i, j).
+
+Each point is located once for all fields. `locate()` only returns local
+leaves, so with MPI every rank fills the points it owns, leaves `nodata`
+elsewhere, and the minimum over ranks is gathered on rank 0.
 */
 static void sample_fields(const extraction_config *cfg, double **field_buffer,
                           int registered_fields)
@@ -221,12 +445,23 @@ static void sample_fields(const extraction_config *cfg, double **field_buffer,
     double x = cfg->Deltax*(i + 1./2) + cfg->xmin;
     for (int j = 0; j < cfg->ny; j++) {
       double y = cfg->Deltay*(j + 1./2) + cfg->ymin;
+      Point point = locate (x, y);
       int k = 0;
       for (scalar s in field_list)
         field_buffer[i][registered_fields*j + k++] =
-          interpolate (s, x, y);
+          point.level >= 0 ? interpolate_linear (point, s, x, y) : nodata;
     }
   }
+
+#if _MPI
+  int n = cfg->nx*(cfg->ny + 1)*registered_fields;
+  if (pid() == 0)
+    MPI_Reduce (MPI_IN_PLACE, field_buffer[0], n, MPI_DOUBLE, MPI_MIN, 0,
+                MPI_COMM_WORLD);
+  else
+    MPI_Reduce (field_buffer[0], NULL, n, MPI_DOUBLE, MPI_MIN, 0,
+                MPI_COMM_WORLD);
+#endif
 }
 
 /**
@@ -237,6 +472,9 @@ Stream rows in the format: `x y field0 field1 ...` to the output stream.
 static void write_fields(const extraction_config *cfg, double **field_buffer,
                          int registered_fields, FILE *fp)
 {
+  if (pid() > 0)
+    return;
+
   for (int i = 0; i < cfg->nx; i++) {
     double x = cfg->Deltax*(i + 1./2) + cfg->xmin;
     for (int j = 0; j < cfg->ny; j++) {
@@ -258,6 +496,529 @@ static void cleanup_output(FILE *fp, double **field_buffer)
   matrix_free (field_buffer);
 }
 
+/**
+## Combined Bundle
+
+Everything `Video.py` needs for one frame from a single restore. The
+bundle is a sequence of float64 `.npy` records:
+1. `facets`, shape (segments, 4): interface segments `x0 y0 x1 y1` in
+   cells overlapping the sampling box, as written by `getFacet --binary
+   --bbox` (edges of the simplified polylines with
+   `--simplify`)
+2. `grid`, shape (nx, ny, 2 + fields): the regular-grid samples with
+   columns `x y field0 field1 ...`, i.e. the text rows of the default mode
+   reshaped
+3. with `--diagnostics` only, `scalars`, shape (4,): time `t`, kinetic
+   energy, liquid volume and maximum velocity magnitude (volumes carry
+   the 2πy weight when `AXI=1`; densities 1 and 1e-3 as in
+   `burstingBubble.c`)
+
+```python
+with open(path, "rb") as fh:
+    facets, grid = np.load(fh), np.load(fh)
+```
+*/
+static void write_grid_npy(const extraction_config *cfg, double **field_buffer,
+                           int registered_fields, FILE *fp)
+{
+  int ncol = 2 + registered_fields;
+  double * rows = malloc(sizeof(double)*cfg->nx*cfg->ny*ncol);
+  for (int i = 0; i < cfg->nx; i++) {
+    double x = cfg->Deltax*(i + 1./2) + cfg->xmin;
+    for (int j = 0; j < cfg->ny; j++) {
+      double * row = rows + ((long) i*cfg->ny + j)*ncol;
+      row[0] = x;
+      row[1] = cfg->Deltay*(j + 1./2) + cfg->ymin;
+      for (int k = 0; k < registered_fields; k++)
+        row[2 + k] = field_buffer[i][registered_fields*j + k];
+    }
+  }
+  long shape[3] = {cfg->nx, cfg->ny, ncol};
+  npy_write_doubles(fp, rows, 3, shape);
+  free(rows);
+}
+
+static void compute_diagnostics(double scalars[4])
+{
+  double ke = 0., volume = 0., umax = 0.;
+  foreach(reduction(+:ke) reduction(+:volume) reduction(max:umax)) {
+#if AXI
+    double dv = 2.*pi*y*sq(Delta);
+#else
+    double dv = sq(Delta);
+#endif
+    double rho = f[] + (1. - f[])*1e-3;
+    double u2 = sq(u.x[]) + sq(u.y[]);
+    ke += 0.5*rho*u2*dv;
+    volume += f[]*dv;
+    umax = max(umax, sqrt(u2));
+  }
+  scalars[0] = t, scalars[1] = ke, scalars[2] = volume, scalars[3] = umax;
+}
+
+static int write_bundle(const extraction_config *cfg, double **field_buffer,
+                        int registered_fields)
+{
+  double box[4] = {cfg->xmin, cfg->ymin, cfg->xmax, cfg->ymax};
+  facet_list facets = collect_facets_region(f, box);
+  gather_facets(&facets);
+  double tol = L0/(1 << depth());
+  double scalars[4];
+  if (cfg->diagnostics)
+    compute_diagnostics(scalars);
+
+  if (pid() > 0) {
+    free_facets(&facets);
+    return 1;
+  }
+
+  FILE * fp = strcmp(cfg->output, "-") ? fopen(cfg->output, "wb") : stdout;
+  if (!fp) {
+    fprintf(stderr, "Error: Cannot write %s\n", cfg->output);
+    free_facets(&facets);
+    return 0;
+  }
+
+  if (cfg->simplify > 0.) {
+    polyline_set lines = stitch_facets(&facets, tol);
+    simplify_polylines(&lines, cfg->simplify);
+    free_facets(&facets);
+    facets = polylines_to_facets(&lines);
+    free_polylines(&lines);
+  }
+
+  write_facets_npy(&facets, fp);
+  write_grid_npy(cfg, field_buffer, registered_fields, fp);
+  if (cfg->diagnostics) {
+    long sshape[1] = {4};
+    npy_write_doubles(fp, scalars, 1, sshape);
+  }
+
+  if (fp == stdout)
+    fflush(fp);
+  else
+    fclose(fp);
+  free_facets(&facets);
+  return 1;
+}
+
+/**
+## Multi-Resolution Pyramid
+
+Export the registered fields as a tile pyramid whose levels mirror the
+quadtree. Pyramid level `L` uses pixels of size `L0/2^L` aligned with the
+tree, so every pixel is exactly one cell of level `L`: leaves coarser than
+`L` fill all the pixels they cover, and deeper regions are represented by
+their restricted (volume-averaged) value at level `L`. No interpolation is
+involved, and the finest level is `depth()`, i.e. MAXlevel where refined.
+
+The coarsest level written is the deepest one at which the whole box still
+fits in a single tile. Output layout in `<dir>`:
+- `pyramid.txt`: tile size, field names, domain origin/size and one
+  `level L h i0 j0 width height ntx nty` line per level, where `(i0, j0)`
+  is the first pixel index of the box and `width x height` its extent
+- `<L>/<tx>_<ty>.npy`: float32 array of shape (fields, tile, tile) with
+  rows along y; pixels past the box edge are NaN
+*/
+static void fill_tile(int L, long pi0, long pj0, int T, float *buffer)
+{
+  double h = L0/(double) (1 << L);
+  double tx0 = X0 + pi0*h, ty0 = Y0 + pj0*h;
+  double tx1 = tx0 + T*h, ty1 = ty0 + T*h;
+  long plane = (long) T*T;
+
+  foreach_cell() {
+    double hd = Delta/2.;
+    if (x + hd <= tx0 || x - hd >= tx1 || y + hd <= ty0 || y - hd >= ty1)
+      continue;
+    if (is_leaf(cell) || level == L) {
+      if (!is_local(cell))
+        continue;
+      int n = 1 << (L - level);
+      long ci = (long) floor((x - hd - X0)/h + 0.5) - pi0;
+      long cj = (long) floor((y - hd - Y0)/h + 0.5) - pj0;
+      for (long b = max(cj, 0); b < min(cj + n, T); b++)
+        for (long a = max(ci, 0); a < min(ci + n, T); a++) {
+          int k = 0;
+          for (scalar s in field_list)
+            buffer[k++*plane + b*T + a] = s[];
+        }
+      continue;
+    }
+  }
+}
+
+/**
+`make_directories()` creates `path` and its missing parents, like
+`mkdir -p`, without going through the shell. Returns 0 on failure.
+*/
+static int make_directories(const char *path)
+{
+  char partial[8192];
+  if (!path[0])
+    return 0;
+  snprintf(partial, sizeof(partial), "%s", path);
+  for (char * c = partial + 1; ; c++)
+    if (*c == '/' || *c == '\0') {
+      char end = *c;
+      *c = '\0';
+      if (mkdir(partial, 0755) && errno != EEXIST)
+        return 0;
+      if (!(*c = end))
+        break;
+    }
+  return 1;
+}
+
+static int write_pyramid(const extraction_config *cfg)
+{
+  char path[8192];
+  FILE * info = NULL;
+  if (pid() == 0) {
+    snprintf(path, sizeof(path), "%s/pyramid.txt", cfg->output);
+    if (make_directories(cfg->output))
+      info = fopen(path, "w");
+  }
+  int ok = pid() > 0 || info != NULL;
+#if _MPI
+  MPI_Bcast(&ok, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  if (!ok) {
+    fprintf(stderr, "Error: Cannot write %s/pyramid.txt\n", cfg->output);
+    return 0;
+  }
+
+  restriction(field_list);
+
+  int T = cfg->tile, nf = list_len(field_list);
+  int Lmin = 0, Lmax = depth();
+  while (Lmin < Lmax) {
+    double h = L0/(double) (1 << (Lmin + 1));
+    if (max(cfg->xmax - cfg->xmin, cfg->ymax - cfg->ymin)/h > T)
+      break;
+    Lmin++;
+  }
+
+  if (info) {
+    fprintf(info, "tile %d\nfields", T);
+    for (scalar s in field_list)
+      fprintf(info, " %s", s.name);
+    fprintf(info, "\norigin %g %g\nL0 %g\nbox %g %g %g %g\nlevels %d %d\n",
+            X0, Y0, L0, cfg->xmin, cfg->ymin, cfg->xmax, cfg->ymax,
+            Lmin, Lmax);
+  }
+
+  float * buffer = malloc(sizeof(float)*nf*T*T);
+  long shape[3] = {nf, T, T};
+  for (int L = Lmin; L <= Lmax; L++) {
+    double h = L0/(double) (1 << L);
+    long n = 1L << L;
+    long i0 = max((long) floor((cfg->xmin - X0)/h), 0);
+    long j0 = max((long) floor((cfg->ymin - Y0)/h), 0);
+    long i1 = min((long) ceil((cfg->xmax - X0)/h), n);
+    long j1 = min((long) ceil((cfg->ymax - Y0)/h), n);
+    long ntx = (i1 - i0 + T - 1)/T, nty = (j1 - j0 + T - 1)/T;
+    if (info) {
+      fprintf(info, "level %d %g %ld %ld %ld %ld %ld %ld\n",
+              L, h, i0, j0, i1 - i0, j1 - j0, ntx, nty);
+      snprintf(path, sizeof(path), "%s/%d", cfg->output, L);
+      if (!make_directories(path)) {
+        fprintf(stderr, "Error: Cannot create %s\n", path);
+        ok = 0;
+      }
+    }
+    for (long ty = 0; ty < nty; ty++)
+      for (long tx = 0; tx < ntx; tx++) {
+        // HUGE_VALF marks unpainted pixels so ranks can be min-reduced
+        for (long k = 0; k < (long) nf*T*T; k++)
+          buffer[k] = HUGE_VALF;
+        long pi0 = i0 + tx*T, pj0 = j0 + ty*T;
+        fill_tile(L, pi0, pj0, T, buffer);
+#if _MPI
+        if (pid() == 0)
+          MPI_Reduce(MPI_IN_PLACE, buffer, nf*T*T, MPI_FLOAT, MPI_MIN, 0,
+                     MPI_COMM_WORLD);
+        else
+          MPI_Reduce(buffer, NULL, nf*T*T, MPI_FLOAT, MPI_MIN, 0,
+                     MPI_COMM_WORLD);
+#endif
+        if (pid() > 0)
+          continue;
+        for (long k = 0; k < (long) nf*T*T; k++)
+          if (buffer[k] == HUGE_VALF)
+            buffer[k] = NAN;
+
+        // blank pixels beyond the box edge in partial tiles
+        for (int k = 0; k < nf; k++)
+          for (long b = 0; b < T; b++)
+            for (long a = 0; a < T; a++)
+              if (pi0 + a >= i1 || pj0 + b >= j1)
+                buffer[(long) k*T*T + b*T + a] = NAN;
+
+        snprintf(path, sizeof(path), "%s/%d/%ld_%ld.npy",
+                 cfg->output, L, tx, ty);
+        FILE * fp = fopen(path, "wb");
+        if (!fp) {
+          fprintf(stderr, "Error: Cannot write %s\n", path);
+          ok = 0;
+          continue;
+        }
+        npy_write_floats(fp, buffer, 3, shape);
+        fclose(fp);
+      }
+  }
+
+  free(buffer);
+  if (info)
+    fclose(info);
+#if _MPI
+  MPI_Bcast(&ok, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  return ok;
+}
+
+/**
+## Adaptive-Mesh Cell List
+
+Write every leaf cell overlapping the box, without resampling, as a single
+float64 `.npy` array of shape (cells, 4 + fields) with columns
+`x y Delta level field0 field1 ...` (field order as registered in
+`register_fields()`). File size scales with the leaf count rather than
+with `(L0/Delta_min)^2`, and MAXlevel detail is preserved exactly.
+*/
+static int write_cells(const extraction_config *cfg)
+{
+  int nf = list_len(field_list), ncol = 4 + nf;
+
+  long n = 0;
+  foreach(serial)
+    if (x + Delta/2. > cfg->xmin && x - Delta/2. < cfg->xmax &&
+        y + Delta/2. > cfg->ymin && y - Delta/2. < cfg->ymax)
+      n++;
+
+  double * rows = malloc(sizeof(double)*max(n, 1)*ncol);
+  long k = 0;
+  foreach(serial)
+    if (x + Delta/2. > cfg->xmin && x - Delta/2. < cfg->xmax &&
+        y + Delta/2. > cfg->ymin && y - Delta/2. < cfg->ymax) {
+      double * row = rows + ncol*k++;
+      row[0] = x, row[1] = y, row[2] = Delta, row[3] = level;
+      int c = 4;
+      for (scalar s in field_list)
+        row[c++] = s[];
+    }
+
+#if _MPI
+  if (!strcmp(cfg->output, "-")) {
+    fprintf(stderr, "Error: --cells - (stdout) is not available with MPI\n");
+    free(rows);
+    return 0;
+  }
+
+  long offset = 0, total = n;
+  MPI_Exscan(&n, &offset, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &total, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  if (pid() == 0)
+    offset = 0;  // MPI_Exscan leaves rank 0 undefined
+
+  long shape[2] = {total, ncol};
+  int ok = 1;
+  if (pid() == 0) {
+    FILE * fp = fopen(cfg->output, "wb");
+    if (fp) {
+      npy_write_header(fp, "<f8", 2, shape);
+      fclose(fp);
+    }
+    else
+      ok = 0;
+  }
+  MPI_Bcast(&ok, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  if (!ok) {
+    fprintf(stderr, "Error: Cannot write %s\n", cfg->output);
+    free(rows);
+    return 0;
+  }
+
+  MPI_File fh;
+  MPI_File_open(MPI_COMM_WORLD, (char *) cfg->output, MPI_MODE_WRONLY,
+                MPI_INFO_NULL, &fh);
+  MPI_Offset start = npy_header_size("<f8", 2, shape) +
+    (MPI_Offset) offset*ncol*sizeof(double);
+  MPI_File_write_at_all(fh, start, rows, (int) (n*ncol), MPI_DOUBLE,
+                        MPI_STATUS_IGNORE);
+  MPI_File_close(&fh);
+#else
+  FILE * fp = strcmp(cfg->output, "-") ? fopen(cfg->output, "wb") : stdout;
+  if (!fp) {
+    fprintf(stderr, "Error: Cannot write %s\n", cfg->output);
+    free(rows);
+    return 0;
+  }
+  long shape[2] = {n, ncol};
+  npy_write_doubles(fp, rows, 2, shape);
+  if (fp == stdout)
+    fflush(fp);
+  else
+    fclose(fp);
+#endif
+
+  free(rows);
+  return 1;
+}
+
+/**
+## Line Extraction
+
+Sample the registered fields along a polyline at the native resolution of
+the tree. Each segment is walked cell by cell: the leaf containing the
+current position is found with `foreach_point()`, the distance to where the
+segment leaves that cell is computed from the cell bounds, and
+`samples_per_cell` equally spaced samples are taken from the entry point
+(the cell-boundary crossing itself) up to the exit. The last vertex is
+always sampled, so refined regions get proportionally denser samples and
+coarse regions are not oversampled.
+
+For every snapshot two float64 `.npy` records are appended to the output:
+the snapshot time, shape (1,), and the samples, shape (n, 4 + fields) with
+columns `s x y Delta field0 field1 ...`, where `s` is the arc length along
+the polyline and `Delta` the size of the sampled cell. A snapshot that
+cannot be restored still gets its two records, a NaN time and zero
+samples, so record `k` always belongs to snapshot `k`.
+
+```python
+with open("line.npy", "rb") as fh:
+    while fh.peek(1):
+        t, samples = np.load(fh)[0], np.load(fh)
+```
+*/
+typedef struct {
+  double * data;
+  long n, size;
+  int ncol;
+} sample_buffer;
+
+static double * sample_row(sample_buffer *b)
+{
+  if (b->n == b->size) {
+    b->size = b->size ? 2*b->size : 1024;
+    b->data = realloc(b->data, sizeof(double)*b->size*b->ncol);
+  }
+  return b->data + b->ncol*b->n++;
+}
+
+static void push_sample(sample_buffer *b, double arc, double px, double py,
+                        double cell_size)
+{
+  double * row = sample_row(b);
+  row[0] = arc, row[1] = px, row[2] = py, row[3] = cell_size;
+  int c = 4;
+  for (scalar s in field_list)
+    row[c++] = interpolate(s, px, py);
+}
+
+static void walk_segment(coord a, coord b, double s0, int per_cell,
+                         sample_buffer *buffer)
+{
+  double length = sqrt(sq(b.x - a.x) + sq(b.y - a.y));
+  if (length <= 0.)
+    return;
+  coord dir = {(b.x - a.x)/length, (b.y - a.y)/length};
+  double eps = 1e-9*L0;
+
+  double s = 0.;
+  while (s < length) {
+    // probe slightly inside the segment so the entered cell is located
+    double px = a.x + (s + eps)*dir.x, py = a.y + (s + eps)*dir.y;
+    double cx = nodata, cy = nodata, cd = nodata;
+    foreach_point(px, py, reduction(min:cx) reduction(min:cy)
+                  reduction(min:cd))
+      cx = x, cy = y, cd = Delta;
+    if (cd == nodata)
+      break;  // left the domain
+
+    double exit = HUGE_VAL;
+    if (dir.x > 0.)
+      exit = min(exit, (cx + cd/2. - a.x)/dir.x);
+    else if (dir.x < 0.)
+      exit = min(exit, (cx - cd/2. - a.x)/dir.x);
+    if (dir.y > 0.)
+      exit = min(exit, (cy + cd/2. - a.y)/dir.y);
+    else if (dir.y < 0.)
+      exit = min(exit, (cy - cd/2. - a.y)/dir.y);
+    exit = max(min(exit, length), s + eps);
+
+    for (int k = 0; k < per_cell; k++) {
+      double sk = s + k*(exit - s)/per_cell;
+      push_sample(buffer, s0 + sk, a.x + sk*dir.x, a.y + sk*dir.y, cd);
+    }
+    s = exit;
+  }
+}
+
+static int write_lines(const extraction_config *cfg)
+{
+  int nvertices;
+  coord * vertices = read_points(cfg->polyline, &nvertices);
+  if (!vertices || nvertices < 2) {
+    fprintf(stderr, "Error: Polyline %s needs at least two points\n",
+            cfg->polyline);
+    free(vertices);
+    return 0;
+  }
+
+  FILE * fp = pid() > 0 ? NULL :
+    cfg->output[0] ? fopen(cfg->output, "wb") : stdout;
+  if (pid() == 0 && !fp) {
+    fprintf(stderr, "Error: Cannot write %s\n", cfg->output);
+    free(vertices);
+    return 0;
+  }
+
+  sample_buffer buffer = {NULL, 0, 0, 4 + list_len(field_list)};
+  for (int n = 0; n < cfg->nsnapshots; n++) {
+    if (!restore (file = cfg->snapshots[n])) {
+      fprintf(stderr, "Warning: Cannot restore %s\n", cfg->snapshots[n]);
+      if (fp) {
+        double missing = NAN;
+        long tshape[1] = {1}, sshape[2] = {0, buffer.ncol};
+        npy_write_doubles(fp, &missing, 1, tshape);
+        npy_write_doubles(fp, buffer.data, 2, sshape);
+      }
+      continue;
+    }
+    compute_fields();
+
+    buffer.n = 0;
+    double s0 = 0.;
+    for (int k = 0; k < nvertices - 1; k++) {
+      walk_segment(vertices[k], vertices[k + 1], s0,
+                   cfg->samples_per_cell, &buffer);
+      s0 += sqrt(sq(vertices[k + 1].x - vertices[k].x) +
+                 sq(vertices[k + 1].y - vertices[k].y));
+    }
+    coord last = vertices[nvertices - 1];
+    double cd = nodata;
+    foreach_point(last.x, last.y, reduction(min:cd))
+      cd = Delta;
+    if (cd != nodata)
+      push_sample(&buffer, s0, last.x, last.y, cd);
+
+    if (fp) {
+      long tshape[1] = {1}, sshape[2] = {buffer.n, buffer.ncol};
+      npy_write_doubles(fp, &t, 1, tshape);
+      npy_write_doubles(fp, buffer.data, 2, sshape);
+    }
+  }
+
+  if (fp == stdout)
+    fflush(fp);
+  else if (fp)
+    fclose(fp);
+  free(buffer.data);
+  free(vertices);
+  return 1;
+}
+
 /**
 ## Strain-Rate Field (D²)
 
@@ -277,8 +1038,127 @@ Same as above but without the D₂₂ term.
 
 Returns log₁₀(μᵣ·D²) where μᵣ is the viscosity ratio (1 in liquid, 0.02 in gas).
 Floor value of -10 for non-positive values.
+
+### Vectorized Evaluation
+
+The stencil differences are gathered from the tree into contiguous arrays
+in one serial traversal, the invariant and its logarithm are evaluated by a
+branch-free loop that the compiler turns into SIMD code, and the result is
+scattered back in a second traversal with the same (deterministic) order.
+The axis guard and the -10 floor are arithmetic selects, and log₁₀ comes
+from `log10_fast()` below.
+
+Auto-vectorization of the loop needs `-O3 -fno-trapping-math` with GCC
+(clang vectorizes at `-O2`); `runPostProcess-Ncases.sh` builds getData that
+way, and adding `-march=native` enables the wider AVX lanes. Use
+`--benchmark N` to compare against `compute_D2c_field_reference()` on a
+given snapshot.
 */
+
+/**
+### Fast log₁₀
+
+Split v = m·2^e with m folded into [1/√2, √2), so t = (m-1)/(m+1) satisfies
+|t| ≤ 0.1716, and sum the atanh series ln m = 2(t + t³/3 + ... + t¹¹/11).
+The truncation error is below 2|t|¹³/13/(1-t²) ≈ 1.8e-11 in ln, i.e. the
+result differs from `log10()` by less than 1e-11 in absolute value for
+every positive double (subnormals are pre-scaled by 2^54). The exponent is
+turned into a double with the 2^52 bit trick so that no integer-to-double
+conversion, and no branch, remains in the loop body.
+*/
+static inline double log10_fast(double v)
+{
+  double scale = v < DBL_MIN ? 18014398509481984. : 1.;  // 2^54
+  double bias = v < DBL_MIN ? 1077. : 1023.;
+  double w = v*scale;
+
+  uint64_t bits;
+  memcpy(&bits, &w, sizeof(bits));
+  uint64_t ebits = (bits >> 52) | 0x4330000000000000ULL;
+  double e;
+  memcpy(&e, &ebits, sizeof(e));
+  e -= 4503599627370496. + bias;  // 2^52 + exponent bias
+
+  bits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+  double m;
+  memcpy(&m, &bits, sizeof(m));
+  double fold = m > M_SQRT2 ? 1. : 0.;
+  m *= 1. - 0.5*fold;
+  e += fold;
+
+  double t = (m - 1.)/(m + 1.), t2 = t*t;
+  double lnm = 2.*t*(1. + t2*(1./3. + t2*(1./5. + t2*(1./7. +
+                 t2*(1./9. + t2*(1./11.))))));
+  return (e*M_LN2 + lnm)*M_LOG10E;
+}
+
+static void strain_rate_kernel(long n,
+                               const double * restrict dyy,
+                               const double * restrict dxx,
+                               const double * restrict dxy,
+                               const double * restrict uy,
+                               const double * restrict r,
+                               const double * restrict fr,
+                               const double * restrict delta,
+                               double * restrict out)
+{
+  for (long k = 0; k < n; k++) {
+    double inv = 1./(2.*delta[k]);
+    double D11 = dyy[k]*inv;
+    double D33 = dxx[k]*inv;
+    double D13 = 0.5*dxy[k]*inv;
+#if AXI
+    double onaxis = r[k] > 1e-10 ? 0. : 1.;  // Epsilon guard for axis
+    double D22 = (1. - onaxis)*uy[k]/(r[k] + onaxis);
+    double D2 = sq(D11) + sq(D22) + sq(D33) + 2.*sq(D13);
+#else
+    double D2 = sq(D11) + sq(D33) + 2.*sq(D13);
+#endif
+    double v = (fr[k] + (1. - fr[k])*2e-2)*D2;
+    double positive = v > 0. ? 1. : 0.;
+    double lg = log10_fast(positive*v + (1. - positive));
+    out[k] = positive*lg - 10.*(1. - positive);
+  }
+}
+
 static void compute_D2c_field(scalar target)
+{
+  long n = 0;
+  foreach(serial)
+    n++;
+
+  double * buffer = malloc(sizeof(double)*8*max(n, 1));
+  double * dyy = buffer, * dxx = buffer + n, * dxy = buffer + 2*n;
+  double * uy = buffer + 3*n, * r = buffer + 4*n, * fr = buffer + 5*n;
+  double * delta = buffer + 6*n, * out = buffer + 7*n;
+
+  long k = 0;
+  foreach(serial) {
+    dyy[k] = u.y[0,1] - u.y[0,-1];
+    dxx[k] = u.x[1,0] - u.x[-1,0];
+    dxy[k] = u.y[1,0] - u.y[-1,0] + u.x[0,1] - u.x[0,-1];
+    uy[k] = u.y[];
+    r[k] = y;
+    fr[k] = f[];
+    delta[k] = Delta;
+    k++;
+  }
+
+  strain_rate_kernel(n, dyy, dxx, dxy, uy, r, fr, delta, out);
+
+  k = 0;
+  foreach(serial)
+    target[] = out[k++];
+
+  free(buffer);
+}
+
+/**
+### Scalar Reference
+
+Original per-cell formulation, kept as the baseline for `--benchmark`.
+*/
+static void compute_D2c_field_reference(scalar target)
 {
   foreach() {
     double D11 = (u.y[0,1] - u.y[0,-1])/(2*Delta);
@@ -302,6 +1182,41 @@ static void compute_D2c_field(scalar target)
   }
 }
 
+/**
+### Micro-Benchmark
+
+Run both kernels `repeats` times on the restored snapshot and report the
+mean wall time per evaluation, the speedup, and the maximum absolute
+deviation between the two results.
+*/
+static void benchmark_D2c(int repeats)
+{
+  scalar ref[];
+  long cells = 0;
+  foreach(reduction(+:cells))
+    cells++;
+
+  timer start = timer_start();
+  for (int i = 0; i < repeats; i++)
+    compute_D2c_field_reference(ref);
+  double t_ref = timer_elapsed(start, NULL)/repeats;
+
+  start = timer_start();
+  for (int i = 0; i < repeats; i++)
+    compute_D2c_field(D2c);
+  double t_vec = timer_elapsed(start, NULL)/repeats;
+
+  double deviation = 0.;
+  foreach(reduction(max:deviation))
+    deviation = max(deviation, fabs(D2c[] - ref[]));
+
+  fprintf(stderr, "cells %ld depth %d repeats %d\n", cells, depth(), repeats);
+  fprintf(stderr, "reference  %.6f s\n", t_ref);
+  fprintf(stderr, "vectorized %.6f s (speedup %.2fx)\n",
+          t_vec, t_ref/t_vec);
+  fprintf(stderr, "max |deviation| %.3e\n", deviation);
+}
+
 /**
 ## Velocity Magnitude Field
 
@@ -19,9 +19,56 @@ for quantitative analysis of interfacial dynamics.
 ## Usage
 
 ```
-./getFacets input_file
+./getFacet [--binary] [--polylines] [--labels] [--simplify EPS] \
+           [--bbox xmin ymin xmax ymax] [--min-size L] input_file
 ```
 
+Options:
+- (none): `output_facets()`-style text (`x y` pairs, blank line between
+  segments) on standard error, as before
+- `--binary`: the segments as one float64 `.npy` record of shape (n, 4),
+  columns `x0 y0 x1 y1`, on standard output
+- `--polylines`: the segments stitched into one polyline per connected
+  interface component, as three `.npy` records on standard output:
+  vertices (nv, 2) float64, offsets (np + 1,) int32 and closed flags
+  (np,) int32. Polyline `k` is `vertices[offsets[k]:offsets[k+1]]`;
+  closed loops repeat their first vertex at the end.
+- `--labels`: after the `--binary` segments, write an int32 (n,) record
+  with the component (polyline) index of every segment; implies
+  `--binary`
+- `--simplify EPS`: stitch and Douglas-Peucker simplify the interface so
+  that it deviates from the PLIC facets by at most `EPS` (physical
+  units), then write it in any of the formats above; segments are then
+  the edges of the simplified polylines
+- `--bbox xmin ymin xmax ymax`: only extract the interface in cells
+  overlapping this box (e.g. the rendered window of a zoomed video)
+- `--min-size L`: drop components whose (clipped) arc length is below `L`
+
+Binary records are written in the order segments, labels, polylines.
+Segments and
+polylines are oriented with the `f = 1` phase on the left, see
+[facet-list.h](../src-local/facet-list.h).
+
+```python
+out = subprocess.run(["./getFacet", "--polylines", snap],
+                     capture_output=True, check=True).stdout
+fh = io.BytesIO(out)
+vertices, offsets, closed = np.load(fh), np.load(fh), np.load(fh)
+```
+
+## MPI Build
+
+Large snapshots can be restored in parallel:
+
+```
+CC99='mpicc -std=c99 -D_GNU_SOURCE=1' qcc -D_MPI=1 -O2 -Wall \
+  -disable-dimensions -I../src-local getFacet.c -o getFacet -lm
+mpirun -np 8 ./getFacet input_file
+```
+
+Each rank reconstructs the facets of its own cells; the segments are
+gathered on rank 0, which stitches and writes them in the requested format.
+
 - Author: Vatsal Sanjay
 vatsalsanjay@gmail.com
 Physics of Fluids Department
@@ -32,9 +79,10 @@ University of Twente
 #include "utils.h"
 #include "output.h"
 #include "fractions.h"
+#include "facet-list.h"
 
 scalar f[];  // Volume fraction field
-char filename[80];
+char filename[4096];
 
 /**
 ### Main Function
@@ -42,12 +90,18 @@ char filename[80];
 Loads a simulation snapshot and extracts the interface facets.
 
 - Input parameters:
-  - `arguments[1]`: Filename of the simulation snapshot to process
+  - `--binary`, `--polylines`: Optional output formats (see Usage)
+  - `--labels`: Also write per-segment component indices
+  - `--simplify EPS`: Maximum deviation of the simplified interface
+  - `--bbox`, `--min-size L`: Region and component-size filters
+  - last argument: Filename of the simulation snapshot to process
 
 - Process:
   1. Restores the simulation state from the specified file
-  2. Extracts interface facets from the volume fraction field
-  3. Outputs facet data to standard error
+  2. Extracts interface facets from the volume fraction field, within
+     the optional box (gathered on rank 0 under MPI)
+  3. Outputs facet data as text to standard error, or as `.npy` records
+     (segments and/or stitched polylines) to standard output
 
 - Return value:
   - Returns 0 on successful completion
@@ -57,13 +111,85 @@ Loads a simulation snapshot and extracts the interface facets.
   field crosses a threshold value (typically 0.5) between adjacent cells.
 */
 int main(int a, char const *arguments[]) {
-  sprintf(filename, "%s", arguments[1]);
-  restore(file = filename);
-
-  FILE *fp = ferr;
-  output_facets(f, fp);
-  fflush(fp);
-  fclose(fp);
+  bool binary = false, polylines = false, labels = false;
+  double simplify = 0., min_size = 0., bbox[4], * box = NULL;
+  int argi = 1;
+  for (; argi < a && !strncmp(arguments[argi], "--", 2); argi++) {
+    if (!strcmp(arguments[argi], "--binary"))
+      binary = true;
+    else if (!strcmp(arguments[argi], "--polylines"))
+      polylines = true;
+    else if (!strcmp(arguments[argi], "--labels"))
+      labels = binary = true;
+    else if (!strcmp(arguments[argi], "--simplify") && argi + 1 < a)
+      simplify = atof(arguments[++argi]);
+    else if (!strcmp(arguments[argi], "--min-size") && argi + 1 < a)
+      min_size = atof(arguments[++argi]);
+    else if (!strcmp(arguments[argi], "--bbox") && argi + 4 < a) {
+      for (int d = 0; d < 4; d++)
+        bbox[d] = atof(arguments[++argi]);
+      box = bbox;
+    }
+    else {
+      fprintf(stderr, "Error: Unknown option %s\n", arguments[argi]);
+      return 1;
+    }
+  }
+  if (argi != a - 1) {
+    fprintf(stderr, "Usage: %s [--binary] [--polylines] [--labels] "
+                    "[--simplify EPS] [--bbox xmin ymin xmax ymax] "
+                    "[--min-size L] input_file\n",
+            arguments[0]);
+    return 1;
+  }
+
+  snprintf(filename, sizeof(filename), "%s", arguments[argi]);
+  if (!restore(file = filename)) {
+    fprintf(stderr, "Error: Cannot restore %s\n", filename);
+    return 1;
+  }
+
+  facet_list facets = collect_facets_region(f, box);
+  gather_facets(&facets);
+  // Link tolerance: one cell at the finest level
+  double tol = L0/(1 << depth());
+
+  // Segments are re-derived from the polylines whenever those are edited
+  // or labelled, so that both outputs describe the same geometry
+  bool rebuild = labels || simplify > 0. || min_size > 0.;
+  polyline_set lines = {NULL};
+  if (pid() == 0 && (polylines || rebuild)) {
+    lines = stitch_facets(&facets, tol);
+    if (min_size > 0.)
+      filter_polylines(&lines, min_size);
+    if (simplify > 0.)
+      simplify_polylines(&lines, simplify);
+    if (rebuild) {
+      free_facets(&facets);
+      facets = polylines_to_facets(&lines);
+    }
+  }
+
+  if (binary || polylines) {
+    if (pid() == 0) {
+      if (binary)
+        write_facets_npy(&facets, stdout);
+      if (labels)
+        write_labels_npy(&lines, stdout);
+      if (polylines)
+        write_polylines_npy(&lines, stdout);
+      fflush(stdout);
+    }
+  }
+  else {
+    FILE *fp = ferr;
+    if (pid() == 0)
+      write_facets_text(&facets, fp);
+    fflush(fp);
+    fclose(fp);
+  }
+  free_polylines(&lines);
+  free_facets(&facets);
 
   return 0;
 }
@@ -0,0 +1,109 @@
+/**
+# Interface Metrics from Simulation Snapshots
+
+Reduce a sequence of snapshots to a small table of the published
+quantities: jet tip height and velocity, neck radius, cavity depth and the
+ejected-drop census.
+
+## Description
+
+Each snapshot is restored in turn and passed to `compute_metrics()` from
+[bubble-metrics.h](../src-local/bubble-metrics.h), which defines every
+column. One row per snapshot is written, so a 500-snapshot case becomes a
+500-line table without rendering or re-parsing facets. The same code runs
+in-situ in [burstingBubble.c](../simulationCases/burstingBubble.c), which
+writes an identical `metrics` file while the simulation runs.
+
+## Usage
+
+```
+./getMetrics [--surface X] [--drops <file>] <snapshot> [<snapshot> ...]
+```
+
+Where:
+- `snapshot`: Basilisk snapshot files, in the desired time order
+- `--surface X`: Axial position of the undisturbed free surface, the
+  reference for the cavity depth (default: 0)
+- `--drops <file>`: Also write one `t volume x y u.x` line per drop
+
+The table (with a header line) goes to stdout:
+
+```python
+m = np.genfromtxt("metrics.txt", names=True)
+plt.plot(m["t"], m["x_tip"])
+```
+
+## MPI Build
+
+```
+CC99='mpicc -std=c99 -D_GNU_SOURCE=1' qcc -D_MPI=1 -O2 -Wall \
+  -disable-dimensions -I../src-local getMetrics.c -o getMetrics -lm
+```
+
+Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
+Affiliation: CoMPhy Lab, Durham University
+*/
+
+#include "utils.h"
+#include "bubble-metrics.h"
+
+scalar f[];
+vector u[];
+
+int main(int argc, char const *argv[])
+{
+  double x_surface = 0.;
+  const char * drops = NULL;
+  int argi = 1;
+  while (argi + 1 < argc && !strncmp(argv[argi], "--", 2)) {
+    if (!strcmp(argv[argi], "--surface"))
+      x_surface = atof(argv[argi + 1]);
+    else if (!strcmp(argv[argi], "--drops"))
+      drops = argv[argi + 1];
+    else {
+      fprintf(stderr, "Error: Unknown option %s\n", argv[argi]);
+      return 1;
+    }
+    argi += 2;
+  }
+
+  if (argi >= argc) {
+    fprintf(stderr, "Usage: %s [--surface X] [--drops <file>] "
+                    "<snapshot> [<snapshot> ...]\n", argv[0]);
+    return 1;
+  }
+
+  FILE * fpd = NULL;
+  int ok = 1;
+  if (pid() == 0 && drops && !(fpd = fopen(drops, "w"))) {
+    fprintf(stderr, "Error: Cannot write %s\n", drops);
+    ok = 0;
+  }
+#if _MPI
+  // every rank must stop, or the others hang in the collectives below
+  MPI_Bcast(&ok, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  if (!ok)
+    return 1;
+  if (pid() == 0)
+    write_metrics_header(stdout);
+
+  for (; argi < argc; argi++) {
+    if (!restore (file = argv[argi])) {
+      fprintf(stderr, "Warning: Cannot restore %s\n", argv[argi]);
+      continue;
+    }
+    bubble_metrics m = compute_metrics(f, u, x_surface);
+    if (pid() == 0) {
+      write_metrics_row(stdout, &m);
+      if (fpd)
+        write_drops(fpd, &m);
+    }
+    free_metrics(&m);
+  }
+
+  fflush(stdout);
+  if (fpd)
+    fclose(fpd);
+  return 0;
+}
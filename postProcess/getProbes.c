@@ -0,0 +1,132 @@
+/**
+# Probe Time Series from Simulation Snapshots
+
+Sample the primitive fields at a fixed set of points across a whole
+sequence of snapshots in a single process.
+
+## Description
+
+Reading a handful of point values (e.g. on the axis at several heights)
+from every snapshot does not need a full `getData` grid per frame. This
+helper restores each snapshot in turn, interpolates `f`, `u.x`, `u.y` and
+`p` at every probe and collects a compact (time x probe x field) array.
+
+The probes are located again after every restore: the mesh adapts between
+snapshots, and a few `locate()` calls cost nothing next to `restore()`.
+
+## Usage
+
+```
+./getProbes [--out <file>] <probes> <snapshot> [<snapshot> ...]
+```
+
+Where:
+- `probes`: Text file with one `x y` point per line (see
+  [point-list.h](../src-local/point-list.h))
+- `snapshot`: Basilisk snapshot files, in the desired time order
+- `--out <file>`: Output file (default: stdout)
+
+## Output
+
+Two concatenated float64 `.npy` records:
+1. `times`, shape (snapshots,)
+2. `values`, shape (snapshots, probes, 4) with fields `f u.x u.y p`
+
+Snapshots that cannot be restored and probes outside the domain are NaN.
+
+```python
+with open("probes.npy", "rb") as fh:
+    times, values = np.load(fh), np.load(fh)
+```
+
+Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
+Affiliation: CoMPhy Lab, Durham University
+*/
+
+#include "utils.h"
+#include "npy-output.h"
+#include "point-list.h"
+
+scalar f[], p[];
+vector u[];
+
+#define NPROBE_FIELDS 4
+
+/**
+## Main Function
+
+Parse options, then loop over snapshots: restore, locate each probe and
+interpolate each field there.
+*/
+int main(int argc, char const *argv[])
+{
+  const char * output = NULL;
+  int argi = 1;
+  if (argi + 1 < argc && !strcmp(argv[argi], "--out")) {
+    output = argv[argi + 1];
+    argi += 2;
+  }
+
+  if (argc - argi < 2) {
+    fprintf(stderr, "Usage: %s [--out <file>] <probes> "
+                    "<snapshot> [<snapshot> ...]\n", argv[0]);
+    return 1;
+  }
+
+  int nprobes;
+  coord * probes = read_points(argv[argi], &nprobes);
+  if (!probes) {
+    fprintf(stderr, "Error: No probes read from %s\n", argv[argi]);
+    return 1;
+  }
+
+  int nsnap = argc - argi - 1;
+  double * times = malloc(sizeof(double)*nsnap);
+  double * values = malloc(sizeof(double)*nsnap*nprobes*NPROBE_FIELDS);
+
+  for (int n = 0; n < nsnap; n++) {
+    const char * filename = argv[argi + 1 + n];
+    double * row = values + (long) n*nprobes*NPROBE_FIELDS;
+    times[n] = NAN;
+    for (int k = 0; k < nprobes*NPROBE_FIELDS; k++)
+      row[k] = NAN;
+
+    if (!restore (file = filename)) {
+      fprintf(stderr, "Warning: Cannot restore %s\n", filename);
+      continue;
+    }
+    times[n] = t;
+
+    for (int k = 0; k < nprobes; k++) {
+      Point point = locate(probes[k].x, probes[k].y);
+      if (point.level < 0)
+        continue;
+      double * v = row + k*NPROBE_FIELDS;
+      v[0] = interpolate_linear(point, f, probes[k].x, probes[k].y);
+      v[1] = interpolate_linear(point, u.x, probes[k].x, probes[k].y);
+      v[2] = interpolate_linear(point, u.y, probes[k].x, probes[k].y);
+      v[3] = interpolate_linear(point, p, probes[k].x, probes[k].y);
+    }
+  }
+
+  fprintf(stderr, "%d snapshots, %d probes\n", nsnap, nprobes);
+
+  FILE * fp = output ? fopen(output, "wb") : stdout;
+  if (!fp) {
+    fprintf(stderr, "Error: Cannot write %s\n", output);
+    return 1;
+  }
+  long tshape[1] = {nsnap};
+  long vshape[3] = {nsnap, nprobes, NPROBE_FIELDS};
+  npy_write_doubles(fp, times, 1, tshape);
+  npy_write_doubles(fp, values, 3, vshape);
+  if (output)
+    fclose(fp);
+  else
+    fflush(fp);
+
+  free(values);
+  free(times);
+  free(probes);
+  return 0;
+}
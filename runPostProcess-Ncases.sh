@@ -39,12 +39,18 @@ Usage: $0 [OPTIONS] CASE_NO [CASE_NO ...]
 
 Run post-processing pipeline on multiple bubble bursting simulation cases.
 For each case, generates video frames with strain-rate and velocity fields,
-and interface facets.
+and interface facets. By default the frames of all cases are rendered by one
+shared pool of workers and each video is encoded as soon as its case is done.
 
 Options:
-    --CPUs N            Number of parallel workers (default: 4)
-    --nGFS N            Number of snapshots to process (default: 500)
-    --tsnap F           Time interval between snapshots (default: 0.01)
+    --CPUs N            Number of parallel workers (default: all cores, or
+                        cores / --mpi ranks; 4 per case with --sequential)
+    --sequential        Run Video.py once per case, one case after another
+                        (always the case with --stream and --watch)
+    --nGFS N            Maximum number of snapshots to process (default: 500)
+    --tsnap F           Minimum time between rendered snapshots; Video.py
+                        renders the snapshots found in intermediate/ and
+                        thins finer output to this interval (default: 0.01)
     --GridsPerR N       Radial grid resolution for video (default: 256)
     --ZMIN F            Minimum Z coordinate (auto-computed from zWall if not set)
     --ZMAX F            Maximum Z coordinate (auto-computed from zWall if not set)
@@ -60,6 +66,28 @@ Options:
     --vel-vmax F        Max value for velocity colorbar (default: 1.0)
 
     --skip-video-encode Skip ffmpeg video encoding after frame generation
+    --segments N        Encode each video as N segments in parallel, started
+                        as their frames finish, then join them (default: 1)
+    --montage           After the shared pool, also render all cases side by
+                        side at matched times into montage.mp4 in the cases
+                        folder (reuses the extraction caches of --cache)
+    --stream            Pipe frames straight into ffmpeg in time order
+                        instead of writing PNGs and encoding afterwards
+    --keep-frames       With --stream, also keep the PNG frames
+    --watch             Follow intermediate/ of a running case: render new
+                        snapshots as they appear and keep <case>-preview.mp4
+                        and metrics.png current (Ctrl-C or --idle-timeout
+                        to stop; cases are watched one after another)
+    --idle-timeout S    In watch mode, stop after S seconds without a new
+                        snapshot (default: 0, watch until interrupted)
+    --cache             Keep helper output in <case>/extraction-cache so
+                        re-rendering with new colorbars skips extraction
+                        (~10 MB per snapshot at the default grid)
+    --mpi N             Build getData/getFacet with MPI and run each helper
+                        call on N ranks (for large MAXlevel snapshots; total
+                        processes = CPUs x N)
+    --simplify EPS      Simplify the interface to a max deviation EPS
+                        (simulation units) before plotting (default: off)
 
     -n, --dry-run       Show what would run without executing
     -v, --verbose       Verbose output
@@ -79,7 +107,7 @@ Examples:
     # Process multiple cases with default settings
     $0 1000 1001 1002
 
-    # Process with 8 CPUs
+    # Process with 8 CPUs shared by both cases
     $0 --CPUs 8 1000 1001
 
     # Process first 100 snapshots only (for testing)
@@ -88,6 +116,9 @@ Examples:
     # Skip video encoding (only generate frames)
     $0 --skip-video-encode 1000 1001
 
+    # MAXlevel-14 snapshots: 2 frames at a time, 8 MPI ranks per helper
+    $0 --CPUs 2 --mpi 8 1000
+
     # Dry run to preview commands
     $0 --dry-run 1000
 
@@ -123,7 +154,9 @@ expand_case_arg() {
 # ============================================================
 # Parse Command Line Options
 # ============================================================
-CPUS=4
+CPUS=""
+SEQUENTIAL=0
+MONTAGE=0
 NGFS=500
 TSNAP=0.01
 GRIDS_PER_R=256
@@ -137,6 +170,14 @@ VEL_VMIN="0.0"
 VEL_VMAX="1.0"
 
 SKIP_VIDEO_ENCODE=0
+STREAM=0
+KEEP_FRAMES=0
+CACHE=0
+SEGMENTS=1
+WATCH=0
+IDLE_TIMEOUT=""
+HELPER_MPI=0
+SIMPLIFY=""
 DRY_RUN=0
 VERBOSE=0
 
@@ -204,6 +245,54 @@ while [[ $# -gt 0 ]]; do
             SKIP_VIDEO_ENCODE=1
             shift
             ;;
+        --sequential)
+            SEQUENTIAL=1
+            shift
+            ;;
+        --montage)
+            MONTAGE=1
+            shift
+            ;;
+        --segments)
+            SEGMENTS="$2"
+            if ! [[ "$SEGMENTS" =~ ^[0-9]+$ ]] || [ "$SEGMENTS" -lt 1 ]; then
+                echo "ERROR: --segments requires a positive integer, got: $SEGMENTS" >&2
+                exit 1
+            fi
+            shift 2
+            ;;
+        --stream)
+            STREAM=1
+            shift
+            ;;
+        --keep-frames)
+            KEEP_FRAMES=1
+            shift
+            ;;
+        --cache)
+            CACHE=1
+            shift
+            ;;
+        --watch)
+            WATCH=1
+            shift
+            ;;
+        --idle-timeout)
+            IDLE_TIMEOUT="$2"
+            shift 2
+            ;;
+        --mpi)
+            HELPER_MPI="$2"
+            if ! [[ "$HELPER_MPI" =~ ^[0-9]+$ ]] || [ "$HELPER_MPI" -lt 1 ]; then
+                echo "ERROR: --mpi requires a positive integer, got: $HELPER_MPI" >&2
+                exit 1
+            fi
+            shift 2
+            ;;
+        --simplify)
+            SIMPLIFY="$2"
+            shift 2
+            ;;
         -n|--dry-run)
             DRY_RUN=1
             shift
@@ -255,6 +344,27 @@ for case_no in "${CASE_NUMBERS[@]}"; do
     fi
 done
 
+# One shared pool over all cases unless a mode needs one Video.py per case
+POOLED=0
+if [ $SEQUENTIAL -eq 0 ] && [ $STREAM -eq 0 ] && [ $WATCH -eq 0 ]; then
+    POOLED=1
+fi
+if [ $MONTAGE -eq 1 ] && [ $POOLED -eq 0 ]; then
+    echo "ERROR: --montage needs the shared pool (no --sequential, --stream or --watch)" >&2
+    exit 1
+fi
+if [ -z "$CPUS" ]; then
+    if [ $POOLED -eq 1 ]; then
+        CPUS=$(nproc 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 4)
+        # Each frame of an MPI helper occupies HELPER_MPI cores
+        if [ $HELPER_MPI -gt 0 ]; then
+            CPUS=$(( CPUS / HELPER_MPI > 0 ? CPUS / HELPER_MPI : 1 ))
+        fi
+    else
+        CPUS=4
+    fi
+fi
+
 # Check Python availability
 if ! command -v python &> /dev/null; then
     echo "ERROR: python not found in PATH" >&2
@@ -273,22 +383,59 @@ if [ ! -f "$VIDEO_SCRIPT" ]; then
     exit 1
 fi
 
+# Check MPI toolchain when helpers run in parallel
+if [ $HELPER_MPI -gt 0 ]; then
+    if ! command -v mpicc &> /dev/null; then
+        echo "ERROR: mpicc not found. --mpi requires mpicc (OpenMPI or MPICH)." >&2
+        exit 1
+    fi
+    if ! command -v mpirun &> /dev/null; then
+        echo "ERROR: mpirun not found. --mpi requires mpirun (OpenMPI or MPICH)." >&2
+        exit 1
+    fi
+fi
+
+# Compile a helper serially, or with MPI when --mpi is given
+compile_helper() {
+    local src="$1"
+    shift
+    if [ $HELPER_MPI -gt 0 ]; then
+        CC99='mpicc -std=c99 -D_GNU_SOURCE=1' qcc -D_MPI=1 "$@" \
+            -Wall -disable-dimensions -I../src-local "$src" -o "${src%.c}" -lm
+    else
+        qcc "$@" -Wall -disable-dimensions -I../src-local "$src" -o "${src%.c}" -lm
+    fi
+}
+
 # Compile C helpers (always recompile to ensure consistency)
 echo "Compiling C helpers..."
 pushd "${SCRIPT_DIR}/postProcess" > /dev/null
 
-if ! qcc -O2 -Wall -disable-dimensions getFacet.c -o getFacet -lm; then
+if ! compile_helper getFacet.c -O2; then
     echo "ERROR: Failed to compile getFacet.c" >&2
     popd > /dev/null
     exit 1
 fi
 
-if ! qcc -O2 -Wall -disable-dimensions getData.c -o getData -lm; then
+# -O3 -fno-trapping-math lets GCC vectorize the strain-rate kernel
+if ! compile_helper getData.c -O3 -fno-trapping-math; then
     echo "ERROR: Failed to compile getData.c" >&2
     popd > /dev/null
     exit 1
 fi
 
+if ! qcc -O2 -Wall -disable-dimensions -I../src-local getProbes.c -o getProbes -lm; then
+    echo "ERROR: Failed to compile getProbes.c" >&2
+    popd > /dev/null
+    exit 1
+fi
+
+if ! compile_helper getMetrics.c -O2; then
+    echo "ERROR: Failed to compile getMetrics.c" >&2
+    popd > /dev/null
+    exit 1
+fi
+
 popd > /dev/null
 echo "C helpers compiled successfully"
 
@@ -316,9 +463,19 @@ echo "  tsnap:      $TSNAP"
 echo "  GridsPerR:  $GRIDS_PER_R"
 echo "  Domain:     Z=[$ZMIN, $ZMAX], R=[0, $RMAX]"
 echo "  Colorbars:  D2=[$D2_VMIN, $D2_VMAX], vel=[$VEL_VMIN, $VEL_VMAX]"
+[ $HELPER_MPI -gt 0 ] && echo "  Helpers:    MPI, $HELPER_MPI ranks per call"
+[ -n "$SIMPLIFY" ] && echo "  Simplify:   max deviation $SIMPLIFY"
 echo ""
 echo "Pipeline:"
-[ $SKIP_VIDEO_ENCODE -eq 0 ] && echo "  [1] Video.py (frames + video)" || echo "  [1] Video.py (frames only, video SKIPPED)"
+[ $POOLED -eq 1 ] && echo "  Shared pool: all cases' frames on $CPUS workers, encoding per finished case"
+[ $MONTAGE -eq 1 ] && echo "  Montage:    all cases side by side -> ${CASES_DIR}/montage.mp4"
+if [ $SKIP_VIDEO_ENCODE -eq 1 ]; then
+    echo "  [1] Video.py (frames only, video SKIPPED)"
+elif [ $STREAM -eq 1 ]; then
+    echo "  [1] Video.py (frames streamed to ffmpeg$([ $KEEP_FRAMES -eq 1 ] && echo ", PNGs kept"))"
+else
+    echo "  [1] Video.py (frames + video)"
+fi
 echo ""
 [ $DRY_RUN -eq 1 ] && echo "Mode: DRY RUN (no execution)"
 echo ""
@@ -327,10 +484,10 @@ echo ""
 # Processing Functions
 # ============================================================
 
-run_video() {
+# Domain bounds of a case: sets CASE_ZMIN and CASE_ZMAX
+case_domain() {
     local case_no="$1"
     local case_dir="${CASES_DIR}/${case_no}"
-    local video_dir="${case_dir}/Video"
     local case_params="${case_dir}/case.params"
 
     # Read zWall from case.params if available, otherwise use default
@@ -351,30 +508,28 @@ run_video() {
     local calc_zmax=$(echo "$calc_zmin + $calc_ldomain" | bc -l)
 
     # Use calculated values if defaults are still in place
-    local use_zmin="$ZMIN"
-    local use_zmax="$ZMAX"
+    CASE_ZMIN="$ZMIN"
+    CASE_ZMAX="$ZMAX"
     if [ "$ZMIN" = "-4.0" ] && [ "$ZMAX" = "4.0" ]; then
         # Defaults - override with calculated values
-        use_zmin="$calc_zmin"
-        use_zmax="$calc_zmax"
+        CASE_ZMIN="$calc_zmin"
+        CASE_ZMAX="$calc_zmax"
     fi
 
     # Validate domain bounds (ZMIN must be less than ZMAX)
-    if (( $(echo "$use_zmin >= $use_zmax" | bc -l) )); then
-        echo "ERROR: Invalid domain bounds: ZMIN ($use_zmin) >= ZMAX ($use_zmax)" >&2
+    if (( $(echo "$CASE_ZMIN >= $CASE_ZMAX" | bc -l) )); then
+        echo "ERROR: Invalid domain bounds: ZMIN ($CASE_ZMIN) >= ZMAX ($CASE_ZMAX)" >&2
         return 1
     fi
+}
 
-    # Build command
-    local cmd_args=(
-        "--caseToProcess" "${case_dir}"
-        "--folderToSave" "${video_dir}"
+# Video.py options shared by every case: sets VIDEO_ARGS
+video_args() {
+    VIDEO_ARGS=(
         "--CPUs" "${CPUS}"
         "--nGFS" "${NGFS}"
         "--tsnap" "${TSNAP}"
         "--GridsPerR" "${GRIDS_PER_R}"
-        "--ZMIN" "${use_zmin}"
-        "--ZMAX" "${use_zmax}"
         "--RMAX" "${RMAX}"
         "--d2-vmin" "${D2_VMIN}"
         "--d2-vmax" "${D2_VMAX}"
@@ -383,17 +538,49 @@ run_video() {
     )
 
     # Add skip flag if needed
-    [ $SKIP_VIDEO_ENCODE -eq 1 ] && cmd_args+=("--skip-video-encode")
+    [ $SKIP_VIDEO_ENCODE -eq 1 ] && VIDEO_ARGS+=("--skip-video-encode")
+    [ $STREAM -eq 1 ] && VIDEO_ARGS+=("--stream")
+    [ $KEEP_FRAMES -eq 1 ] && VIDEO_ARGS+=("--keep-frames")
+    [ $CACHE -eq 1 ] && VIDEO_ARGS+=("--cache")
+    [ $SEGMENTS -gt 1 ] && VIDEO_ARGS+=("--segments" "${SEGMENTS}")
+    [ $WATCH -eq 1 ] && VIDEO_ARGS+=("--watch")
+    [ -n "$IDLE_TIMEOUT" ] && VIDEO_ARGS+=("--idle-timeout" "${IDLE_TIMEOUT}")
+    [ $HELPER_MPI -gt 0 ] && VIDEO_ARGS+=("--helper-mpi" "${HELPER_MPI}")
+    [ -n "$SIMPLIFY" ] && VIDEO_ARGS+=("--simplify" "${SIMPLIFY}")
+    return 0
+}
 
+run_video_script() {
     if [ $VERBOSE -eq 1 ] || [ $DRY_RUN -eq 1 ]; then
-        echo "  CMD: python ${VIDEO_SCRIPT} ${cmd_args[*]}"
+        echo "  CMD: python ${VIDEO_SCRIPT} $*"
     fi
 
     if [ $DRY_RUN -eq 0 ]; then
-        python "${VIDEO_SCRIPT}" "${cmd_args[@]}"
+        python "${VIDEO_SCRIPT}" "$@"
     fi
 }
 
+run_video() {
+    local case_no="$1"
+    local case_dir="${CASES_DIR}/${case_no}"
+    local video_dir="${case_dir}/Video"
+
+    case_domain "$case_no" || return 1
+    video_args
+    run_video_script \
+        "--caseToProcess" "${case_dir}" \
+        "--folderToSave" "${video_dir}" \
+        "--ZMIN" "${CASE_ZMIN}" \
+        "--ZMAX" "${CASE_ZMAX}" \
+        "${VIDEO_ARGS[@]}"
+}
+
+# All queued cases in one Video.py call (one worker pool): POOL_ARGS
+run_video_pool() {
+    video_args
+    run_video_script "${VIDEO_ARGS[@]}" "${POOL_ARGS[@]}"
+}
+
 # ============================================================
 # Main Processing Loop
 # ============================================================
@@ -404,6 +591,8 @@ echo "========================================="
 SUCCESSFUL_CASES=()
 FAILED_CASES=()
 FAILURE_REASONS=()
+POOL_CASES=()
+POOL_ARGS=()
 
 for case_no in "${CASE_NUMBERS[@]}"; do
     echo ""
@@ -433,7 +622,7 @@ for case_no in "${CASE_NUMBERS[@]}"; do
     snapshot_count=$(find "$intermediate_dir" -name "snapshot-*" 2>/dev/null | wc -l | tr -d ' ')
     echo "  Found $snapshot_count snapshots in intermediate/"
 
-    if [ "$snapshot_count" -eq 0 ]; then
+    if [ "$snapshot_count" -eq 0 ] && [ $WATCH -eq 0 ]; then
         echo "  ERROR: No snapshots found"
         FAILED_CASES+=("$case_no")
         FAILURE_REASONS+=("No snapshots in intermediate/")
@@ -447,6 +636,19 @@ for case_no in "${CASE_NUMBERS[@]}"; do
         echo "  Parameters: Oh=$(get_param "Oh" "?"), Bond=$(get_param "Bond" "?"), MAXlevel=$(get_param "MAXlevel" "?")"
     fi
 
+    # Shared pool: queue the case, everything runs after the loop
+    if [ $POOLED -eq 1 ]; then
+        if case_domain "$case_no"; then
+            POOL_CASES+=("$case_no")
+            POOL_ARGS+=("--case" "$case_dir" "$CASE_ZMIN" "$CASE_ZMAX")
+            echo "  Queued for the shared pool (Z=[$CASE_ZMIN, $CASE_ZMAX])"
+        else
+            FAILED_CASES+=("$case_no")
+            FAILURE_REASONS+=("Invalid domain bounds")
+        fi
+        continue
+    fi
+
     # Track step failures
     step_failed=0
 
@@ -473,6 +675,42 @@ for case_no in "${CASE_NUMBERS[@]}"; do
     fi
 done
 
+if [ ${#POOL_CASES[@]} -gt 0 ]; then
+    echo ""
+    echo "-----------------------------------------"
+    echo "Shared pool: ${POOL_CASES[*]}"
+    echo "-----------------------------------------"
+    pool_log=$(mktemp)
+    if run_video_pool 2>&1 | tee "$pool_log"; then
+        SUCCESSFUL_CASES+=("${POOL_CASES[@]}")
+    else
+        # Video.py logs "[ERROR] <case> failed: <reason>" for each failed case
+        for case_no in "${POOL_CASES[@]}"; do
+            if grep -q "\[ERROR\] ${case_no} failed:" "$pool_log" \
+                || ! grep -q "Shared pool done" "$pool_log"; then
+                FAILED_CASES+=("$case_no")
+                FAILURE_REASONS+=("Shared pool: $(grep -m1 -o "\[ERROR\] ${case_no} failed: .*" "$pool_log" | cut -d' ' -f4- || echo "Video.py aborted")")
+            else
+                SUCCESSFUL_CASES+=("$case_no")
+            fi
+        done
+    fi
+    rm -f "$pool_log"
+
+    if [ $MONTAGE -eq 1 ]; then
+        echo ""
+        echo "Montage: ${CASES_DIR}/montage.mp4"
+        video_args  # carries the sweep's --cache, so panels reuse its extractions
+        if ! run_video_script "${VIDEO_ARGS[@]}" "${POOL_ARGS[@]}" \
+                "--montage" "--folderToSave" "${CASES_DIR}/montage"; then
+            echo "  ERROR: Montage failed"
+            # Listed with the failed cases so the run exits non-zero
+            FAILED_CASES+=("montage")
+            FAILURE_REASONS+=("Montage of ${POOL_CASES[*]} failed")
+        fi
+    fi
+fi
+
 # ============================================================
 # Summary
 # ============================================================
@@ -375,17 +375,17 @@ if [ $STAGE -eq 1 ] || [ $STAGE -eq 0 ]; then
     if [ $FOPENMP_ENABLED -eq 1 ]; then
         echo "Compiling with OpenMP..."
         [ $VERBOSE -eq 1 ] && echo "Compiler: qcc"
-        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions -fopenmp $DEBUG_FLAGS $QCC_FLAGS"
+        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions -I../../src-local -fopenmp $DEBUG_FLAGS $QCC_FLAGS"
 
-        qcc -O2 -Wall -disable-dimensions -fopenmp \
+        qcc -O2 -Wall -disable-dimensions -I../../src-local -fopenmp \
             $DEBUG_FLAGS $QCC_FLAGS \
             "$SRC_FILE_LOCAL" -o "$EXECUTABLE" -lm
     else
         echo "Compiling for serial execution..."
         [ $VERBOSE -eq 1 ] && echo "Compiler: qcc"
-        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions $DEBUG_FLAGS $QCC_FLAGS"
+        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions -I../../src-local $DEBUG_FLAGS $QCC_FLAGS"
 
-        qcc -O2 -Wall -disable-dimensions \
+        qcc -O2 -Wall -disable-dimensions -I../../src-local \
             $DEBUG_FLAGS $QCC_FLAGS \
             "$SRC_FILE_LOCAL" -o "$EXECUTABLE" -lm
     fi
@@ -458,36 +458,36 @@ if [ $STAGE -eq 2 ] || [ $STAGE -eq 0 ]; then
         if [ "$OS_TYPE" = "Darwin" ]; then
             # macOS
             [ $VERBOSE -eq 1 ] && echo "Compiler: CC99='mpicc -std=c99' qcc"
-            [ $VERBOSE -eq 1 ] && echo "Flags: -Wall -O2 -D_MPI=1 -disable-dimensions $DEBUG_FLAGS $QCC_FLAGS"
+            [ $VERBOSE -eq 1 ] && echo "Flags: -Wall -O2 -D_MPI=1 -disable-dimensions -I../../src-local $DEBUG_FLAGS $QCC_FLAGS"
 
             CC99='mpicc -std=c99' qcc \
-                -Wall -O2 -D_MPI=1 -disable-dimensions \
+                -Wall -O2 -D_MPI=1 -disable-dimensions -I../../src-local \
                 $DEBUG_FLAGS $QCC_FLAGS \
                 "$SRC_FILE_LOCAL" -o "$EXECUTABLE" -lm
         else
             # Linux
             [ $VERBOSE -eq 1 ] && echo "Compiler: CC99='mpicc -std=c99 -D_GNU_SOURCE=1' qcc"
-            [ $VERBOSE -eq 1 ] && echo "Flags: -Wall -O2 -D_MPI=1 -disable-dimensions $DEBUG_FLAGS $QCC_FLAGS"
+            [ $VERBOSE -eq 1 ] && echo "Flags: -Wall -O2 -D_MPI=1 -disable-dimensions -I../../src-local $DEBUG_FLAGS $QCC_FLAGS"
 
             CC99='mpicc -std=c99 -D_GNU_SOURCE=1' qcc \
-                -Wall -O2 -D_MPI=1 -disable-dimensions \
+                -Wall -O2 -D_MPI=1 -disable-dimensions -I../../src-local \
                 $DEBUG_FLAGS $QCC_FLAGS \
                 "$SRC_FILE_LOCAL" -o "$EXECUTABLE" -lm
         fi
     elif [ $FOPENMP_ENABLED -eq 1 ]; then
         echo "Compiling with OpenMP..."
         [ $VERBOSE -eq 1 ] && echo "Compiler: qcc"
-        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions -fopenmp $DEBUG_FLAGS $QCC_FLAGS"
+        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions -I../../src-local -fopenmp $DEBUG_FLAGS $QCC_FLAGS"
 
-        qcc -O2 -Wall -disable-dimensions -fopenmp \
+        qcc -O2 -Wall -disable-dimensions -I../../src-local -fopenmp \
             $DEBUG_FLAGS $QCC_FLAGS \
             "$SRC_FILE_LOCAL" -o "$EXECUTABLE" -lm
     else
         echo "Compiling for serial execution..."
         [ $VERBOSE -eq 1 ] && echo "Compiler: qcc"
-        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions $DEBUG_FLAGS $QCC_FLAGS"
+        [ $VERBOSE -eq 1 ] && echo "Flags: -O2 -Wall -disable-dimensions -I../../src-local $DEBUG_FLAGS $QCC_FLAGS"
 
-        qcc -O2 -Wall -disable-dimensions \
+        qcc -O2 -Wall -disable-dimensions -I../../src-local \
             $DEBUG_FLAGS $QCC_FLAGS \
             "$SRC_FILE_LOCAL" -o "$EXECUTABLE" -lm
     fi
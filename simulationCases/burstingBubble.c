@@ -38,6 +38,10 @@ Where:
 
 - `FILTERED`: Enable density and viscosity jump smoothing
 - `tsnap`: Time interval between snapshots (default: 1e-2)
+- `tmetrics`: Time interval of the in-situ interface metrics (1e-3)
+- `jetEvery`, `jetBand`: Timesteps between jet-tracking records (10) and
+  radial band of near-axis cells they use (0.5)
+- `ttracer`: Time interval of the tracer trajectory frames (1e-3)
 - `fErr`: Error tolerance for volume fraction (1e-3)
 - `KErr`: Error tolerance for curvature calculation (1e-6)
 - `VelErr`: Error tolerance for velocity field (1e-3)
@@ -48,11 +52,18 @@ Where:
 #include "navier-stokes/conserving.h"
 #include "tension.h"
 
+#include "bubble-metrics.h"
+#include "tracers.h"
+
 #if !_MPI
 #include "distance.h"
 #endif
 
 #define tsnap (1e-2)
+#define tmetrics (1e-3) // Interval of the in-situ interface metrics
+#define jetEvery (10)   // Timesteps between jet-tracking records
+#define jetBand (0.5)   // Radial extent of the cells used by jet tracking
+#define ttracer (1e-3)  // Interval of the tracer trajectory frames
 
 // Error tolerances
 #define fErr (1e-3)   // Error tolerance in f1 VOF
@@ -233,6 +244,93 @@ event writingFiles(t = 0; t += tsnap; t <= tmax) {
   dump(file = nameOut);
 }
 
+/**
+## Interface Metrics
+
+Computes the jet tip height and velocity, neck radius, cavity depth and
+the ejected-drop census every `tmetrics` (see
+[bubble-metrics.h](../src-local/bubble-metrics.h) for the definitions).
+- One row per call is appended to `metrics`, the same table that
+  `postProcess/getMetrics` produces from snapshots
+- One line per drop is appended to `drops`
+- The undisturbed free surface is at x = 0 (bubble top)
+*/
+event metrics(t = 0; t += tmetrics; t <= tmax) {
+  bubble_metrics m = compute_metrics(f, u, 0.);
+  if (pid() == 0) {
+    FILE *fp = fopen("metrics", i == 0 ? "w" : "a");
+    if (i == 0)
+      write_metrics_header(fp);
+    write_metrics_row(fp, &m);
+    fclose(fp);
+
+    fp = fopen("drops", i == 0 ? "w" : "a");
+    write_drops(fp, &m);
+    fclose(fp);
+  }
+  free_metrics(&m);
+}
+
+/**
+## Jet Tracking
+
+Resolves the jet tip velocity peak, which falls between snapshots, by
+recording the tip height, tip velocity and neck every `jetEvery` steps.
+Only cells within `jetBand` of the axis are visited, so the cost is small
+next to a timestep. Records of raw doubles `i t x_tip u_tip r_neck x_neck`
+are appended to the binary file `jet`:
+
+```python
+jet = np.fromfile("jet", dtype=np.float64).reshape(-1, 6)
+```
+*/
+event jetTracking(i += jetEvery) {
+  FILE *fp = NULL;
+  if (pid() == 0)
+    fp = fopen("jet", i == 0 ? "wb" : "ab");
+  track_jet(f, u, jetBand, fp);
+  if (fp)
+    fclose(fp);
+}
+
+/**
+## Tracer Particles
+
+Lagrangian tracers (see [tracers.h](../src-local/tracers.h)) reveal
+where the liquid of the ejected drops comes from.
+- Seeded on a fresh start in the liquid next to the interface of the
+  bubble cap and the surrounding free surface (-1 < x < 0.5, y < 2), half
+  a cell from the interface
+- Resumed from the last frame of `tracers` after a restart
+- Advected every timestep with the updated velocity
+- One frame of all positions is appended to `tracers` every `ttracer`
+*/
+static void tracersStart(void) {
+  static bool started = false;
+  if (started)
+    return;
+  started = true;
+  if (i == 0) {
+    if (pid() == 0)
+      remove("tracers");
+    tracers_seed(f, (double[]){-1., 0., 0.5, 2.}, 0.5);
+  }
+  else
+    tracers_resume("tracers");
+}
+
+event tracerParticles(i++) {
+  tracersStart();
+  long lost = tracers_advect(u, dt);
+  if (lost > 0 && pid() == 0)
+    fprintf(ferr, "%ld tracers left the domain at t = %g\n", lost, t);
+}
+
+event tracerOutput(t = 0; t += ttracer; t <= tmax) {
+  tracersStart();
+  tracers_write("tracers");
+}
+
 /**
 ## Simulation Termination
 
@@ -0,0 +1,304 @@
+/**
+# Bursting-Bubble Interface Metrics
+
+The quantities we publish for each time, computed directly from `f` and
+`u`: jet tip height and velocity, minimum neck radius, cavity depth and a
+census of the ejected drops. Usable post-hoc on restored snapshots
+([getMetrics.c](../postProcess/getMetrics.c)) and in-situ from an event of
+[burstingBubble.c](../simulationCases/burstingBubble.c).
+
+## Definitions
+
+Coordinates are Basilisk's axisymmetric ones: `x` axial (the wall is at
+`X0`, liquid below the free surface), `y` radial. The axis is resolved on
+a uniform set of axial bins of the finest cell size `L0/2^depth()`:
+
+- **Axis column**: the volume fraction and axial velocity of the cells
+  touching the axis (`y < Delta`), one value per bin.
+- **Jet tip** `x_tip`: the top of the liquid column that is contiguous
+  with the wall along the axis, refined with the volume fraction of the
+  first gas bin above it. Drops above a gap on the axis are not part of
+  the column. `u_tip` is the axial velocity in the last liquid bin.
+- **Cavity depth**: `x_surface - x_tip`, the depth of the axis column top
+  below the undisturbed free surface `x_surface`; it is negative once the
+  jet rises above the surface.
+- **Jet radius** `r(x)`: per bin, the smallest radius at which gas
+  (`f < 1`) is found, with the interfacial cell contributing
+  `y - Delta/2 + f Delta`; bins without gas are infinite.
+- **Neck**: walking down from the tip, `r(x)` first widens into the tip
+  bulb; the neck is the following local minimum (`r_neck` and its
+  position `x_neck`). NaN while the jet has no bulb.
+- **Drops**: connected liquid regions (`f > 1e-3`, labelled with
+  Basilisk's `tag()`) other than the largest one, the pool. Each drop
+  reports its volume (`2 pi y` weighted), centroid and volume-averaged
+  axial velocity. The row carries the drop count, total drop volume and
+  the volume and velocity of the highest drop (the first one ejected).
+
+## Usage
+
+```c
+#include "bubble-metrics.h"   // includes tag.h
+bubble_metrics m = compute_metrics (f, u, 0.);
+if (pid() == 0) {
+  write_metrics_header (fp);   // once
+  write_metrics_row (fp, &m);
+  write_drops (fpd, &m);       // optional, one line per drop
+}
+free_metrics (&m);
+```
+
+All ranks must call `compute_metrics()`; the results are reduced so every
+rank holds the same values. For high-frequency tracking of the jet alone,
+`track_jet()` (see [Jet Tracking](#jet-tracking)) only visits the cells
+near the axis.
+
+Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
+Affiliation: CoMPhy Lab, Durham University
+*/
+
+#ifndef BUBBLE_METRICS_H
+#define BUBBLE_METRICS_H
+
+#include "tag.h"
+
+#define METRICS_DROP_COLUMNS 4  // volume, x centroid, y centroid, u.x
+
+typedef struct {
+  double t;
+  double x_tip, u_tip;
+  double r_neck, x_neck;
+  double cavity_depth;
+  int ndrops;
+  double drop_volume;           // total over all drops
+  double top_volume, top_ux;    // highest drop
+  double * drops;               // METRICS_DROP_COLUMNS per drop
+} bubble_metrics;
+
+/**
+## Axis Profiles
+
+Fills the axis volume fraction, axis velocity and jet radius per bin.
+Only cells overlapping the band `y < band` are visited (the tree walk
+prunes everything farther from the axis), so a narrow band makes the
+profiles cheap enough to evaluate every few timesteps; gas beyond the band
+is not seen. Every bin is covered by exactly one leaf, so empty entries
+are `HUGE` and the ranks are combined with a minimum.
+*/
+static void metrics_profiles (scalar c, vector u, double band,
+                              int nbins, double dx,
+                              double * faxis, double * uaxis, double * rgas)
+{
+  for (int b = 0; b < nbins; b++)
+    faxis[b] = uaxis[b] = rgas[b] = HUGE;
+  foreach_cell() {
+    if (y - Delta/2. > band)
+      continue;
+    if (is_leaf (cell)) {
+      if (is_local (cell)) {
+        int b0 = max (0, (int) floor ((x - Delta/2. - X0)/dx + 0.5));
+        int b1 = min (nbins, b0 + max (1, (int) (Delta/dx + 0.5)));
+        double r = c[] < 1. - 1e-6 ? y - Delta/2. + c[]*Delta : HUGE;
+        for (int b = b0; b < b1; b++) {
+          if (y < Delta) {
+            faxis[b] = c[];
+            uaxis[b] = u.x[];
+          }
+          rgas[b] = min (rgas[b], r);
+        }
+      }
+      continue;
+    }
+  }
+  mpi_all_reduce_array (faxis, double, MPI_MIN, nbins);
+  mpi_all_reduce_array (uaxis, double, MPI_MIN, nbins);
+  mpi_all_reduce_array (rgas, double, MPI_MIN, nbins);
+}
+
+/**
+## Neck Search
+
+From the tip bin downwards: climb the bulb (non-decreasing `r`), then
+descend to the first local minimum. Plateaus from coarse cells are walked
+through; reaching the all-liquid pool (`HUGE`) or the wall means there is
+no neck yet.
+*/
+static int metrics_neck (const double * rgas, int tip)
+{
+  int k = tip;
+  while (k > 0 && rgas[k - 1] >= rgas[k] && rgas[k - 1] < HUGE)
+    k--;
+  if (k == 0 || rgas[k - 1] >= HUGE)
+    return -1;
+  while (k > 0 && rgas[k - 1] <= rgas[k])
+    k--;
+  if (k == 0 || rgas[k - 1] >= HUGE)
+    return -1;
+  return k;
+}
+
+/**
+## Drop Census
+
+`tag()` labels the connected liquid regions; volumes, centroids and
+momenta are summed per label and reduced over the ranks. The largest
+region is the pool and is excluded.
+*/
+static void metrics_drops (scalar c, vector u, bubble_metrics * m)
+{
+  scalar tagged[];
+  foreach()
+    tagged[] = c[] > 1e-3;
+  int n = tag (tagged);
+
+  double * sums = calloc (4*max (n, 1), sizeof(double));
+  foreach (serial, noauto)
+    if (tagged[] > 0) {
+      double * s = sums + 4*((int) tagged[] - 1);
+      double dv = 2.*pi*y*sq(Delta)*c[];
+      s[0] += dv, s[1] += dv*x, s[2] += dv*y, s[3] += dv*u.x[];
+    }
+#if _MPI
+  MPI_Allreduce (MPI_IN_PLACE, sums, 4*n, MPI_DOUBLE, MPI_SUM,
+                 MPI_COMM_WORLD);
+#endif
+
+  int pool = 0;
+  for (int j = 1; j < n; j++)
+    if (sums[4*j] > sums[4*pool])
+      pool = j;
+
+  m->ndrops = 0;
+  m->drops = malloc (METRICS_DROP_COLUMNS*max (n, 1)*sizeof(double));
+  m->drop_volume = 0.;
+  m->top_volume = m->top_ux = nodata;
+  double xtop = - HUGE;
+  for (int j = 0; j < n; j++) {
+    double * s = sums + 4*j;
+    if (j == pool || s[0] <= 0.)
+      continue;
+    double * d = m->drops + METRICS_DROP_COLUMNS*m->ndrops++;
+    d[0] = s[0], d[1] = s[1]/s[0], d[2] = s[2]/s[0], d[3] = s[3]/s[0];
+    m->drop_volume += d[0];
+    if (d[1] > xtop)
+      xtop = d[1], m->top_volume = d[0], m->top_ux = d[3];
+  }
+  free (sums);
+}
+
+/**
+## Metrics
+
+`x_surface` is the axial position of the undisturbed free surface, the
+reference for the cavity depth. `metrics_axis()` fills the axis-based
+fields (tip, neck, cavity) from the profiles within `band`.
+*/
+static void metrics_axis (scalar c, vector u, double x_surface, double band,
+                          bubble_metrics * m)
+{
+  int nbins = 1 << depth();
+  double dx = L0/nbins;
+  double * faxis = malloc (3*nbins*sizeof(double));
+  double * uaxis = faxis + nbins, * rgas = uaxis + nbins;
+  metrics_profiles (c, u, band, nbins, dx, faxis, uaxis, rgas);
+
+  int tip = -1;
+  while (tip + 1 < nbins && faxis[tip + 1] > 0.5)
+    tip++;
+  if (tip < 0) {
+    m->x_tip = m->u_tip = m->cavity_depth = nodata;
+    m->r_neck = m->x_neck = nodata;
+  }
+  else {
+    double partial = tip + 1 < nbins ? faxis[tip + 1] : 0.;
+    m->x_tip = X0 + (tip + 1 + partial)*dx;
+    m->u_tip = uaxis[tip];
+    m->cavity_depth = x_surface - m->x_tip;
+    int neck = metrics_neck (rgas, tip);
+    m->r_neck = neck < 0 ? nodata : rgas[neck];
+    m->x_neck = neck < 0 ? nodata : X0 + (neck + 0.5)*dx;
+  }
+  free (faxis);
+}
+
+bubble_metrics compute_metrics (scalar c, vector u, double x_surface)
+{
+  bubble_metrics m = {.t = t};
+  metrics_axis (c, u, x_surface, HUGE, &m);
+  metrics_drops (c, u, &m);
+  return m;
+}
+
+/**
+## Jet Tracking
+
+The lightweight subset for high-frequency in-situ use: tip height, tip
+velocity and neck from the cells within `band` of the axis, without the
+drop census. The neck is only found if the jet (including its bulb) is
+narrower than `band`. `track_jet()` appends one record of
+`JET_TRACK_COLUMNS` raw doubles, `i t x_tip u_tip r_neck x_neck`, to
+`fp` (NaN where undefined):
+
+```python
+jet = np.fromfile("jet", dtype=np.float64).reshape(-1, 6)
+```
+*/
+#define JET_TRACK_COLUMNS 6
+
+void track_jet (scalar c, vector u, double band, FILE * fp)
+{
+  bubble_metrics m = {.t = t};
+  metrics_axis (c, u, 0., band, &m);
+  if (pid() == 0) {
+    double record[JET_TRACK_COLUMNS] = {
+      i, t, m.x_tip == nodata ? NAN : m.x_tip,
+      m.u_tip == nodata ? NAN : m.u_tip,
+      m.r_neck == nodata ? NAN : m.r_neck,
+      m.x_neck == nodata ? NAN : m.x_neck
+    };
+    fwrite (record, sizeof(double), JET_TRACK_COLUMNS, fp);
+  }
+}
+
+/**
+## Output
+
+One whitespace-separated row per time; undefined values (`nodata`) are
+written as `nan` so the table loads directly with `np.loadtxt`.
+`write_drops()` adds one `t volume x y u.x` line per drop.
+*/
+static double metrics_value (double v)
+{
+  return v == nodata ? NAN : v;
+}
+
+void write_metrics_header (FILE * fp)
+{
+  fprintf (fp, "t x_tip u_tip r_neck x_neck cavity_depth "
+           "n_drops V_drops V_top u_top\n");
+}
+
+void write_metrics_row (FILE * fp, const bubble_metrics * m)
+{
+  fprintf (fp, "%g %.8g %.8g %.8g %.8g %.8g %d %.8g %.8g %.8g\n",
+           m->t, metrics_value (m->x_tip), metrics_value (m->u_tip),
+           metrics_value (m->r_neck), metrics_value (m->x_neck),
+           metrics_value (m->cavity_depth), m->ndrops, m->drop_volume,
+           metrics_value (m->top_volume), metrics_value (m->top_ux));
+}
+
+void write_drops (FILE * fp, const bubble_metrics * m)
+{
+  for (int j = 0; j < m->ndrops; j++) {
+    const double * d = m->drops + METRICS_DROP_COLUMNS*j;
+    fprintf (fp, "%g %.8g %.8g %.8g %.8g\n", m->t, d[0], d[1], d[2], d[3]);
+  }
+}
+
+void free_metrics (bubble_metrics * m)
+{
+  free (m->drops);
+  m->drops = NULL;
+  m->ndrops = 0;
+}
+
+#endif // BUBBLE_METRICS_H
@@ -0,0 +1,466 @@
+/**
+# Interface Facet Lists
+
+Collect the VOF interface as an in-memory array of segments instead of
+printing it directly, so that helpers can gather it across MPI ranks and
+write it in whichever format they need.
+
+## Description
+
+`collect_facets()` reconstructs the same PLIC segments as Basilisk's
+`output_facets()` (Youngs/mixed-Youngs-centered normal, `plane_alpha`,
+`facets`) and stores them as `x0 y0 x1 y1` quadruples. Under MPI every
+rank collects its local cells and `gather_facets()` concatenates all
+segments on rank 0; in serial it is a no-op.
+
+Segments are oriented consistently: walking from `(x0, y0)` to `(x1, y1)`
+the `c = 1` phase lies on the left. `stitch_facets()` uses this to chain
+the segments of each connected interface component into an open or closed
+polyline without any orientation guesswork.
+
+## Usage
+
+```c
+#include "fractions.h"
+#include "facet-list.h"
+facet_list facets = collect_facets (f);
+gather_facets (&facets);
+if (pid() == 0)
+  write_facets_text (&facets, fp);
+free_facets (&facets);
+```
+
+and, for connected polylines (on rank 0, after the gather):
+
+```c
+polyline_set lines = stitch_facets (&facets, L0/(1 << depth()));
+simplify_polylines (&lines, 1e-3);   // optional
+write_polylines_npy (&lines, stdout);
+free_polylines (&lines);
+```
+
+Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
+Affiliation: CoMPhy Lab, Durham University
+*/
+
+#include "npy-output.h"
+
+typedef struct {
+  double * xy;  // 4 entries per segment: x0 y0 x1 y1
+  long n, size;
+} facet_list;
+
+static void facet_push (facet_list * l, double x0, double y0,
+                        double x1, double y1)
+{
+  if (l->n == l->size) {
+    l->size = l->size ? 2*l->size : 1024;
+    l->xy = realloc (l->xy, 4*l->size*sizeof(double));
+  }
+  double * s = l->xy + 4*l->n++;
+  s[0] = x0, s[1] = y0, s[2] = x1, s[3] = y1;
+}
+
+/**
+## Collection
+
+Only interfacial cells (1e-6 < c < 1 - 1e-6) contribute, exactly as in
+`output_facets()`. The interface normal points from `c = 1` towards
+`c = 0`, so the endpoints are swapped whenever the tangent `p1 - p0` would
+put the `c = 1` side on the right.
+
+`collect_facets_region()` only visits cells overlapping the box
+`{xmin, ymin, xmax, ymax}` (`NULL` for the whole domain): whole subtrees
+outside it are skipped, so zoomed extractions cost little more than the
+region itself.
+*/
+facet_list collect_facets_region (scalar c, const double * box)
+{
+  facet_list l = {NULL, 0, 0};
+  facet_list * lp = &l;
+  foreach_cell() {
+    if (box && (x + Delta/2. < box[0] || x - Delta/2. > box[2] ||
+                y + Delta/2. < box[1] || y - Delta/2. > box[3]))
+      continue;
+    if (is_leaf (cell)) {
+      if (is_local (cell) && c[] > 1e-6 && c[] < 1. - 1e-6) {
+        coord n = interface_normal (point, c);
+        double alpha = plane_alpha (c[], n);
+        coord segment[2];
+        if (facets (n, alpha, segment) == 2) {
+          int a = 0, b = 1;
+          if ((segment[1].y - segment[0].y)*n.x -
+              (segment[1].x - segment[0].x)*n.y < 0.)
+            a = 1, b = 0;
+          facet_push (lp,
+                      x + segment[a].x*Delta, y + segment[a].y*Delta,
+                      x + segment[b].x*Delta, y + segment[b].y*Delta);
+        }
+      }
+      continue;
+    }
+  }
+  return l;
+}
+
+facet_list collect_facets (scalar c)
+{
+  return collect_facets_region (c, NULL);
+}
+
+/**
+## MPI Gather
+
+Concatenate the segments of all ranks on rank 0 (rank order); other
+ranks are left with an empty list.
+*/
+void gather_facets (facet_list * l)
+{
+#if _MPI
+  int np = npe(), count = 4*l->n;
+  int * counts = NULL, * displs = NULL;
+  double * all = NULL;
+  if (pid() == 0) {
+    counts = malloc (np*sizeof(int));
+    displs = malloc (np*sizeof(int));
+  }
+  MPI_Gather (&count, 1, MPI_INT, counts, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+  long total = 0;
+  if (pid() == 0) {
+    for (int r = 0; r < np; r++) {
+      displs[r] = total;
+      total += counts[r];
+    }
+    all = malloc (max(total, 1)*sizeof(double));
+  }
+  MPI_Gatherv (l->xy, count, MPI_DOUBLE,
+               all, counts, displs, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+  free (l->xy);
+  l->xy = all;
+  l->n = l->size = total/4;
+  free (counts);
+  free (displs);
+#endif
+}
+
+/**
+## Stitching
+
+Neighbouring PLIC segments do not share endpoints exactly (the
+reconstruction is discontinuous across cell faces), so the end of each
+segment is linked to the nearest *start* of another segment within `tol`.
+Starts are binned on a `tol`-sized lattice and sorted, so each lookup only
+scans the 3x3 neighbouring bins. Links are made greedily in segment order
+and every start is used at most once.
+
+Chains are then walked from segments nobody links into (open polylines,
+e.g. ending on the axis or at a domain boundary); whatever is left forms
+closed loops. Joints are placed at the midpoint of the two endpoints being
+linked. Closed polylines repeat their first vertex at the end, so every
+polyline can be drawn or integrated directly.
+
+`start[k]` .. `start[k+1]` delimit the vertices of polyline `k`.
+*/
+
+typedef struct {
+  double * xy;       // 2 entries per vertex
+  int32_t * start;   // np + 1 offsets into the vertices
+  int32_t * closed;  // 1 for closed loops, 0 for open polylines
+  long nv, np;
+} polyline_set;
+
+typedef struct {
+  long kx, ky, i;
+} facet_bin;
+
+static int facet_bin_compare (const void * a, const void * b)
+{
+  const facet_bin * p = a, * q = b;
+  if (p->kx != q->kx)
+    return p->kx < q->kx ? -1 : 1;
+  if (p->ky != q->ky)
+    return p->ky < q->ky ? -1 : 1;
+  return (p->i > q->i) - (p->i < q->i);
+}
+
+static long facet_bin_lower (const facet_bin * bins, long n, long kx, long ky)
+{
+  long lo = 0, hi = n;
+  while (lo < hi) {
+    long mid = (lo + hi)/2;
+    if (bins[mid].kx < kx || (bins[mid].kx == kx && bins[mid].ky < ky))
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+static void polyline_vertex (polyline_set * p, long * size,
+                             double x, double y)
+{
+  if (p->nv == *size) {
+    *size = *size ? 2**size : 1024;
+    p->xy = realloc (p->xy, 2**size*sizeof(double));
+  }
+  p->xy[2*p->nv] = x, p->xy[2*p->nv + 1] = y;
+  p->nv++;
+}
+
+static void polyline_joint (polyline_set * p, long * size,
+                            const double * a, const double * b)
+{
+  polyline_vertex (p, size, (a[2] + b[0])/2., (a[3] + b[1])/2.);
+}
+
+polyline_set stitch_facets (const facet_list * l, double tol)
+{
+  long n = l->n;
+  polyline_set p = {NULL, malloc ((n + 1)*sizeof(int32_t)),
+                    malloc ((n + 1)*sizeof(int32_t)), 0, 0};
+  long size = 0;
+  p.start[0] = 0;
+  if (n == 0)
+    return p;
+
+  facet_bin * bins = malloc (n*sizeof(facet_bin));
+  for (long i = 0; i < n; i++)
+    bins[i] = (facet_bin){floor (l->xy[4*i]/tol),
+                          floor (l->xy[4*i + 1]/tol), i};
+  qsort (bins, n, sizeof(facet_bin), facet_bin_compare);
+
+  long * next = malloc (n*sizeof(long)), * prev = malloc (n*sizeof(long));
+  for (long i = 0; i < n; i++)
+    next[i] = prev[i] = -1;
+
+  for (long i = 0; i < n; i++) {
+    const double * e = l->xy + 4*i + 2;
+    long kx = floor (e[0]/tol), ky = floor (e[1]/tol), best = -1;
+    double dmin = sq(tol);
+    for (long bx = kx - 1; bx <= kx + 1; bx++)
+      for (long by = ky - 1; by <= ky + 1; by++)
+        for (long b = facet_bin_lower (bins, n, bx, by);
+             b < n && bins[b].kx == bx && bins[b].ky == by; b++) {
+          long j = bins[b].i;
+          if (j == i || prev[j] >= 0)
+            continue;
+          double d = sq(l->xy[4*j] - e[0]) + sq(l->xy[4*j + 1] - e[1]);
+          if (d <= dmin)
+            dmin = d, best = j;
+        }
+    if (best >= 0)
+      next[i] = best, prev[best] = i;
+  }
+  free (bins);
+
+  char * used = calloc (n, 1);
+  for (int pass = 0; pass < 2; pass++)
+    for (long i = 0; i < n; i++) {
+      if (used[i] || (pass == 0 && prev[i] >= 0))
+        continue;
+      // pass 0: open chains from their head, pass 1: remaining loops
+      const double * s = l->xy + 4*i;
+      if (pass == 0)
+        polyline_vertex (&p, &size, s[0], s[1]);
+      long j = i;
+      for (;;) {
+        used[j] = 1;
+        long k = next[j];
+        if (k < 0) {
+          polyline_vertex (&p, &size, l->xy[4*j + 2], l->xy[4*j + 3]);
+          break;
+        }
+        polyline_joint (&p, &size, l->xy + 4*j, l->xy + 4*k);
+        if (k == i) {
+          polyline_vertex (&p, &size, p.xy[2*p.start[p.np]],
+                           p.xy[2*p.start[p.np] + 1]);
+          break;
+        }
+        j = k;
+      }
+      p.closed[p.np] = (pass == 1);
+      p.start[++p.np] = p.nv;
+    }
+
+  free (used);
+  free (next);
+  free (prev);
+  return p;
+}
+
+/**
+## Simplification
+
+Douglas-Peucker on every polyline: a vertex is dropped when it lies within
+`eps` (physical units) of the chord between the vertices kept around it,
+so the simplified curve never deviates from the original by more than
+`eps`. The endpoints are always kept; for closed loops (first vertex
+repeated) the chord degenerates to a point and the first split falls on
+the vertex farthest from it. An explicit stack replaces recursion, since
+polylines at high levels have tens of thousands of vertices. Vertices are
+compacted in place and the offsets updated.
+*/
+
+static double segment_distance (const double * p, const double * a,
+                                const double * b)
+{
+  double dx = b[0] - a[0], dy = b[1] - a[1], l2 = sq(dx) + sq(dy);
+  double s = l2 > 0. ? ((p[0] - a[0])*dx + (p[1] - a[1])*dy)/l2 : 0.;
+  s = s < 0. ? 0. : s > 1. ? 1. : s;
+  return sqrt (sq(p[0] - a[0] - s*dx) + sq(p[1] - a[1] - s*dy));
+}
+
+void simplify_polylines (polyline_set * p, double eps)
+{
+  if (p->nv == 0)
+    return;
+  char * keep = calloc (p->nv, 1);
+  long * stack = malloc (2*p->nv*sizeof(long));
+  for (long k = 0; k < p->np; k++) {
+    long first = p->start[k], last = p->start[k + 1] - 1;
+    keep[first] = keep[last] = 1;
+    long top = 0;
+    stack[top++] = first, stack[top++] = last;
+    while (top > 0) {
+      long j = stack[--top], i = stack[--top], far = -1;
+      double dmax = eps;
+      for (long m = i + 1; m < j; m++) {
+        double d = segment_distance (p->xy + 2*m, p->xy + 2*i, p->xy + 2*j);
+        if (d > dmax)
+          dmax = d, far = m;
+      }
+      if (far >= 0) {
+        keep[far] = 1;
+        stack[top++] = i, stack[top++] = far;
+        stack[top++] = far, stack[top++] = j;
+      }
+    }
+  }
+
+  long nv = 0;
+  for (long k = 0; k < p->np; k++) {
+    long first = p->start[k], last = p->start[k + 1];
+    p->start[k] = nv;
+    for (long m = first; m < last; m++)
+      if (keep[m]) {
+        p->xy[2*nv] = p->xy[2*m], p->xy[2*nv + 1] = p->xy[2*m + 1];
+        nv++;
+      }
+  }
+  p->start[p->np] = p->nv = nv;
+  free (stack);
+  free (keep);
+}
+
+/**
+Break polylines back into `x0 y0 x1 y1` segments, for consumers of the
+plain segment formats.
+*/
+facet_list polylines_to_facets (const polyline_set * p)
+{
+  facet_list l = {NULL, 0, 0};
+  for (long k = 0; k < p->np; k++)
+    for (long m = p->start[k]; m < p->start[k + 1] - 1; m++)
+      facet_push (&l, p->xy[2*m], p->xy[2*m + 1],
+                  p->xy[2*m + 2], p->xy[2*m + 3]);
+  return l;
+}
+
+/**
+## Component Filtering
+
+`filter_polylines()` drops polylines shorter than `min_length` (arc
+length, physical units), e.g. satellite droplets or debris below the
+resolution of interest. `polyline_labels()` returns, for every segment of
+`polylines_to_facets()`, the index of the polyline it belongs to.
+*/
+
+void filter_polylines (polyline_set * p, double min_length)
+{
+  long nv = 0, np = 0;
+  for (long k = 0; k < p->np; k++) {
+    long first = p->start[k], last = p->start[k + 1];
+    double length = 0.;
+    for (long m = first; m < last - 1; m++)
+      length += sqrt (sq(p->xy[2*m + 2] - p->xy[2*m]) +
+                      sq(p->xy[2*m + 3] - p->xy[2*m + 1]));
+    if (length < min_length)
+      continue;
+    p->start[np] = nv;
+    p->closed[np++] = p->closed[k];
+    for (long m = first; m < last; m++, nv++)
+      p->xy[2*nv] = p->xy[2*m], p->xy[2*nv + 1] = p->xy[2*m + 1];
+  }
+  p->np = np;
+  p->start[np] = p->nv = nv;
+}
+
+int32_t * polyline_labels (const polyline_set * p)
+{
+  int32_t * labels = malloc ((max(p->nv - p->np, 0) + 1)*sizeof(int32_t));
+  long n = 0;
+  for (long k = 0; k < p->np; k++)
+    for (long m = p->start[k]; m < p->start[k + 1] - 1; m++)
+      labels[n++] = k;
+  return labels;
+}
+
+void free_polylines (polyline_set * p)
+{
+  free (p->xy);
+  free (p->start);
+  free (p->closed);
+  p->xy = NULL, p->start = p->closed = NULL;
+  p->nv = p->np = 0;
+}
+
+/**
+## Writers
+
+`write_facets_text()` reproduces the `output_facets()` text layout: two
+`x y` lines per segment followed by a blank line.
+*/
+void write_facets_text (const facet_list * l, FILE * fp)
+{
+  for (long k = 0; k < l->n; k++) {
+    const double * s = l->xy + 4*k;
+    fprintf (fp, "%g %g\n%g %g\n\n", s[0], s[1], s[2], s[3]);
+  }
+}
+
+/**
+`write_facets_npy()` writes one float64 record of shape (n, 4);
+`write_labels_npy()` writes `polyline_labels()` as an int32 (n,) record;
+`write_polylines_npy()` writes the vertices (nv, 2) as float64, followed by
+the int32 offsets (np + 1,) and closed flags (np,).
+*/
+void write_facets_npy (const facet_list * l, FILE * fp)
+{
+  long shape[2] = {l->n, 4};
+  npy_write_doubles (fp, l->xy, 2, shape);
+}
+
+void write_labels_npy (const polyline_set * p, FILE * fp)
+{
+  int32_t * labels = polyline_labels (p);
+  long shape[1] = {max(p->nv - p->np, 0)};
+  npy_write_ints (fp, labels, 1, shape);
+  free (labels);
+}
+
+void write_polylines_npy (const polyline_set * p, FILE * fp)
+{
+  long vshape[2] = {p->nv, 2}, sshape[1] = {p->np + 1}, cshape[1] = {p->np};
+  npy_write_doubles (fp, p->xy, 2, vshape);
+  npy_write_ints (fp, p->start, 1, sshape);
+  npy_write_ints (fp, p->closed, 1, cshape);
+}
+
+void free_facets (facet_list * l)
+{
+  free (l->xy);
+  l->xy = NULL;
+  l->n = l->size = 0;
+}
@@ -0,0 +1,124 @@
+/**
+# NumPy `.npy` Output
+
+Minimal writer for the NumPy `.npy` (format version 1.0) container used by
+the binary modes of the post-processing helpers.
+
+## Description
+
+Each record is a self-describing header followed by the raw C-ordered
+payload, so Python reads it without any parsing:
+
+```python
+with open(path, "rb") as fh:
+    a = np.load(fh)   # one record
+    b = np.load(fh)   # the next one, if the helper wrote several
+```
+
+Records can be concatenated in a single stream (file, pipe) and read back
+sequentially with repeated `np.load` calls on the same handle. Payloads are
+written in host byte order, which is little-endian on every platform we
+run on; the header advertises `<f8`, `<f4` or `<i4` accordingly.
+
+## Usage
+
+```c
+#include "npy-output.h"
+long shape[2] = {n, 4};
+npy_write_doubles (fp, data, 2, shape);
+```
+
+Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
+Affiliation: CoMPhy Lab, Durham University
+*/
+
+#ifndef NPY_OUTPUT_H
+#define NPY_OUTPUT_H
+
+#include <stdint.h>
+
+/**
+## Header
+
+The header is the magic string, the version and a Python-literal dictionary
+padded with spaces so that the payload starts on a 64-byte boundary (this
+keeps single-record files `np.load(..., mmap_mode="r")` friendly).
+*/
+static int npy_format_dict (char * dict, int size, const char * descr,
+                            int ndim, const long * shape)
+{
+  int len = snprintf (dict, size,
+                      "{'descr': '%s', 'fortran_order': False, 'shape': (",
+                      descr);
+  for (int d = 0; d < ndim; d++)
+    len += snprintf (dict + len, size - len, "%ld,%s",
+                     shape[d], d < ndim - 1 ? " " : "");
+  len += snprintf (dict + len, size - len, "), }");
+  return len;
+}
+
+static int npy_padding (int len)
+{
+  return (64 - (10 + len + 1) % 64) % 64;
+}
+
+void npy_write_header (FILE * fp, const char * descr,
+                       int ndim, const long * shape)
+{
+  char dict[512];
+  int len = npy_format_dict (dict, sizeof(dict), descr, ndim, shape);
+  int pad = npy_padding (len);
+  uint16_t hlen = (uint16_t) (len + pad + 1);
+  unsigned char prefix[10] = {0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+                              hlen & 0xff, hlen >> 8};
+  fwrite (prefix, 1, sizeof(prefix), fp);
+  fwrite (dict, 1, len, fp);
+  for (int i = 0; i < pad; i++)
+    fputc (' ', fp);
+  fputc ('\n', fp);
+}
+
+/**
+Number of bytes occupied by the header for a given shape; used by writers
+that need payload offsets up front (e.g. collective MPI-IO).
+*/
+long npy_header_size (const char * descr, int ndim, const long * shape)
+{
+  char dict[512];
+  int len = npy_format_dict (dict, sizeof(dict), descr, ndim, shape);
+  return 10 + len + 1 + npy_padding (len);
+}
+
+static long npy_count (int ndim, const long * shape)
+{
+  long n = 1;
+  for (int d = 0; d < ndim; d++)
+    n *= shape[d];
+  return n;
+}
+
+/**
+## Payload Writers
+*/
+void npy_write_doubles (FILE * fp, const double * data,
+                        int ndim, const long * shape)
+{
+  npy_write_header (fp, "<f8", ndim, shape);
+  fwrite (data, sizeof(double), npy_count (ndim, shape), fp);
+}
+
+void npy_write_floats (FILE * fp, const float * data,
+                       int ndim, const long * shape)
+{
+  npy_write_header (fp, "<f4", ndim, shape);
+  fwrite (data, sizeof(float), npy_count (ndim, shape), fp);
+}
+
+void npy_write_ints (FILE * fp, const int32_t * data,
+                     int ndim, const long * shape)
+{
+  npy_write_header (fp, "<i4", ndim, shape);
+  fwrite (data, sizeof(int32_t), npy_count (ndim, shape), fp);
+}
+
+#endif // NPY_OUTPUT_H
@@ -0,0 +1,59 @@
+/**
+# Point Lists
+
+Reader for the plain-text point files used by the probe and line
+extractors.
+
+## Format
+
+One point per line as `x y` (Basilisk coordinates: x axial, y radial for
+axisymmetric cases). Blank lines and lines starting with `#` are ignored.
+
+## Usage
+
+```c
+#include "point-list.h"
+int n;
+coord * points = read_points ("probes.txt", &n);
+...
+free (points);
+```
+
+Returns `NULL` (and leaves `*n` at 0) if the file cannot be opened or
+contains no points.
+
+Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
+Affiliation: CoMPhy Lab, Durham University
+*/
+
+#ifndef POINT_LIST_H
+#define POINT_LIST_H
+
+coord * read_points (const char * path, int * n)
+{
+  *n = 0;
+  FILE * fp = fopen (path, "r");
+  if (!fp)
+    return NULL;
+
+  int size = 16;
+  coord * points = malloc (size*sizeof(coord));
+  char line[1024];
+  while (fgets (line, sizeof(line), fp)) {
+    double px, py;
+    if (line[0] == '#' || sscanf (line, "%lf %lf", &px, &py) != 2)
+      continue;
+    if (*n == size)
+      points = realloc (points, (size *= 2)*sizeof(coord));
+    points[(*n)++] = (coord){px, py};
+  }
+  fclose (fp);
+
+  if (*n == 0) {
+    free (points);
+    return NULL;
+  }
+  return points;
+}
+
+#endif // POINT_LIST_H
@@ -0,0 +1,325 @@
+/**
+# Lagrangian Tracer Particles
+
+Massless tracers advected with the interpolated velocity, so we can tell
+where the liquid of an ejected drop came from without dense snapshots.
+
+## Description
+
+Each rank owns the tracers that lie in its local leaves. A timestep moves
+them with a midpoint (RK2) step in the current velocity field, sampled with
+`interpolate_linear()` in the containing leaf. Tracers that cross into
+another rank's subdomain, at the midpoint or at the end of the step, are
+migrated: every rank contributes its leavers to an `MPI_Allgatherv` and
+keeps those it now owns. Tracers that leave the domain are dropped. The
+radial coordinate is reflected at the axis.
+
+## Trajectory Stream
+
+`tracers_write()` appends one frame per call to a binary file. A frame is
+a float64 header `t n` followed by `n` float32 triples `id x y`, so a
+few thousand tracers cost tens of kB per frame:
+
+```python
+def read_tracers(path):
+    data, off, frames = open(path, "rb").read(), 0, []
+    while off < len(data):
+        t, n = np.frombuffer(data, np.float64, 2, off); off += 16
+        rec = np.frombuffer(data, np.float32, 3*int(n), off).reshape(-1, 3)
+        frames.append((t, rec)); off += 12*int(n)
+    return frames
+```
+
+Ids are stable over the run, so `rec[:, 0]` links positions across frames.
+
+## Usage
+
+```c
+#include "tracers.h"
+tracers_seed (f, (double[]){xmin, ymin, xmax, ymax}, 0.5);  // once
+...
+tracers_advect (u, dt);       // every timestep, after the velocity update
+...
+tracers_write ("tracers");    // at the output interval
+```
+
+All ranks must call these functions.
+
+After a restart, `tracers_resume()` reloads the last frame written at or
+before the current time and truncates the frames after it, so appended
+frames continue the trajectory with monotonic times.
+
+Author: Vatsal Sanjay (vatsal.sanjay@comphy-lab.org)
+Affiliation: CoMPhy Lab, Durham University
+*/
+
+#include <unistd.h>
+
+#define TRACER_DOUBLES 5  // id x y and the start of the current step
+
+typedef struct {
+  double id, x, y;
+  double x0, y0;
+} tracer;
+
+typedef struct {
+  tracer * p;
+  long n, size;
+} tracer_list;
+
+tracer_list tracers = {NULL, 0, 0};
+
+static void tracer_push (tracer_list * l, tracer p)
+{
+  if (l->n == l->size) {
+    l->size = l->size ? 2*l->size : 256;
+    l->p = realloc (l->p, l->size*sizeof(tracer));
+  }
+  l->p[l->n++] = p;
+}
+
+static bool tracer_local (double x, double y)
+{
+  Point point = locate (x, y);
+  return point.level >= 0;
+}
+
+/**
+## Seeding
+
+One tracer per interfacial leaf inside the box `{xmin, ymin, xmax, ymax}`
+(e.g. the bubble cap and the neighbouring free surface), at the PLIC
+segment midpoint moved `offset` cells into the liquid (`-n` direction).
+Ids are numbered consecutively over the ranks.
+*/
+void tracers_seed (scalar c, const double box[4], double offset)
+{
+  tracer_list * l = &tracers;
+  l->n = 0;
+  foreach (serial, noauto)
+    if (c[] > 1e-6 && c[] < 1. - 1e-6 &&
+        x >= box[0] && x <= box[2] && y >= box[1] && y <= box[3]) {
+      coord n = interface_normal (point, c);
+      double alpha = plane_alpha (c[], n);
+      coord s[2];
+      if (facets (n, alpha, s) == 2) {
+        double norm = sqrt (sq(n.x) + sq(n.y));
+        double px = x + (s[0].x + s[1].x)/2.*Delta - offset*Delta*n.x/norm;
+        double py = y + (s[0].y + s[1].y)/2.*Delta - offset*Delta*n.y/norm;
+        tracer_push (l, (tracer){0, px, fabs (py), px, fabs (py)});
+      }
+    }
+
+  long first = 0;
+#if _MPI
+  MPI_Exscan (&l->n, &first, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  if (pid() == 0)
+    first = 0;
+#endif
+  for (long k = 0; k < l->n; k++)
+    l->p[k].id = first + k;
+}
+
+/**
+## Migration
+
+Keep the tracers that are still local, exchange the others. Returns the
+number of tracers lost (outside every subdomain) over all ranks.
+*/
+static long tracers_migrate (void)
+{
+  tracer_list * l = &tracers;
+  long kept = 0, lost = 0;
+  tracer * leavers = NULL;
+  int nleave = 0;
+  for (long k = 0; k < l->n; k++) {
+    if (tracer_local (l->p[k].x, l->p[k].y))
+      l->p[kept++] = l->p[k];
+    else {
+      leavers = realloc (leavers, (nleave + 1)*sizeof(tracer));
+      leavers[nleave++] = l->p[k];
+    }
+  }
+  l->n = kept;
+
+#if _MPI
+  int np = npe(), * counts = malloc (np*sizeof(int));
+  int * displs = malloc (np*sizeof(int)), count = TRACER_DOUBLES*nleave;
+  MPI_Allgather (&count, 1, MPI_INT, counts, 1, MPI_INT, MPI_COMM_WORLD);
+  long total = 0;
+  for (int r = 0; r < np; r++)
+    displs[r] = total, total += counts[r];
+  tracer * all = malloc (max (total, 1)*sizeof(double));
+  MPI_Allgatherv (leavers, count, MPI_DOUBLE,
+                  all, counts, displs, MPI_DOUBLE, MPI_COMM_WORLD);
+  long found = 0;
+  for (long k = 0; k < total/TRACER_DOUBLES; k++)
+    if (tracer_local (all[k].x, all[k].y)) {
+      tracer_push (l, all[k]);
+      found++;
+    }
+  mpi_all_reduce (found, MPI_LONG, MPI_SUM);
+  lost = total/TRACER_DOUBLES - found;
+  free (all);
+  free (displs);
+  free (counts);
+#else
+  lost = nleave;
+#endif
+  free (leavers);
+  return lost;
+}
+
+/**
+## Advection
+
+Midpoint rule over `dt`: half a step with the velocity at the start,
+migrate, then the full step from the start position with the velocity at
+the midpoint, and migrate again. The step starts with a migration too,
+since `adapt_wavelet()` may have moved leaves to other ranks since the
+last call. Sampling a tracer outside the local leaves is a bug, so it
+aborts rather than interpolating from an invalid `Point`.
+*/
+static void tracers_velocity (vector u, const tracer * p, double * ux,
+                              double * uy)
+{
+  Point point = locate (p->x, p->y);
+  if (point.level < 0) {
+    fprintf (ferr, "tracers: tracer %g at (%g, %g) is not local on rank %d\n",
+             p->id, p->x, p->y, pid());
+#if _MPI
+    MPI_Abort (MPI_COMM_WORLD, 1);
+#endif
+    exit (1);
+  }
+  *ux = interpolate_linear (point, u.x, p->x, p->y);
+  *uy = interpolate_linear (point, u.y, p->x, p->y);
+}
+
+long tracers_advect (vector u, double dt)
+{
+  tracer_list * l = &tracers;
+  long lost = tracers_migrate();
+  for (long k = 0; k < l->n; k++) {
+    tracer * p = l->p + k;
+    double ux, uy;
+    tracers_velocity (u, p, &ux, &uy);
+    p->x0 = p->x, p->y0 = p->y;
+    p->x += dt/2.*ux;
+    p->y = fabs (p->y + dt/2.*uy);
+  }
+  lost += tracers_migrate();
+
+  for (long k = 0; k < l->n; k++) {
+    tracer * p = l->p + k;
+    double ux, uy;
+    tracers_velocity (u, p, &ux, &uy);
+    p->x = p->x0 + dt*ux;
+    p->y = fabs (p->y0 + dt*uy);
+  }
+  return lost + tracers_migrate();
+}
+
+/**
+## Output
+
+All tracers are gathered on rank 0, which appends the frame to `path`.
+*/
+void tracers_write (const char * path)
+{
+  tracer_list * l = &tracers;
+  float * rec = malloc (3*max (l->n, 1)*sizeof(float));
+  for (long k = 0; k < l->n; k++) {
+    rec[3*k] = l->p[k].id;
+    rec[3*k + 1] = l->p[k].x;
+    rec[3*k + 2] = l->p[k].y;
+  }
+  int count = 3*l->n;
+  long total = count;
+  float * all = rec;
+#if _MPI
+  int np = npe(), * counts = NULL, * displs = NULL;
+  if (pid() == 0) {
+    counts = malloc (np*sizeof(int));
+    displs = malloc (np*sizeof(int));
+  }
+  MPI_Gather (&count, 1, MPI_INT, counts, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  total = 0;
+  if (pid() == 0) {
+    for (int r = 0; r < np; r++)
+      displs[r] = total, total += counts[r];
+    all = malloc (max (total, 1)*sizeof(float));
+  }
+  MPI_Gatherv (rec, count, MPI_FLOAT, all, counts, displs, MPI_FLOAT, 0,
+               MPI_COMM_WORLD);
+  free (counts);
+  free (displs);
+#endif
+
+  if (pid() == 0) {
+    FILE * fp = fopen (path, "ab");
+    if (fp) {
+      double header[2] = {t, total/3};
+      fwrite (header, sizeof(double), 2, fp);
+      fwrite (all, sizeof(float), total, fp);
+      fclose (fp);
+    }
+  }
+  if (all != rec)
+    free (all);
+  free (rec);
+}
+
+/**
+## Restart
+
+Read the frames of `path` on rank 0, keep the last one with a time not
+after `t`, and let every rank adopt the tracers in its subdomain. The file
+is cut after that frame: frames written past `t` by the previous run would
+otherwise precede the new ones. A frame exactly at `t` is cut as well,
+since `tracers_write()` repeats it when the output event fires at `t`. Returns the number of tracers restored (0
+if there is no usable frame).
+*/
+long tracers_resume (const char * path)
+{
+  tracer_list * l = &tracers;
+  l->n = 0;
+  float * last = NULL;
+  long n = 0;
+  if (pid() == 0) {
+    FILE * fp = fopen (path, "rb");
+    long end = 0, start = 0;  // where the next frame of the new run goes
+    double header[2];
+    while (fp && (start = ftell (fp)) >= 0 &&
+           fread (header, sizeof(double), 2, fp) == 2) {
+      long m = header[1];
+      float * rec = malloc (3*max (m, 1)*sizeof(float));
+      if (fread (rec, sizeof(float), 3*m, fp) != (size_t) (3*m) ||
+          header[0] > t) {
+        free (rec);
+        break;
+      }
+      free (last);
+      last = rec, n = m;
+      end = header[0] < t ? ftell (fp) : start;
+    }
+    if (fp) {
+      fclose (fp);
+      if (truncate (path, end))
+        fprintf (ferr, "tracers: cannot truncate %s after t = %g\n", path, t);
+    }
+  }
+#if _MPI
+  MPI_Bcast (&n, 1, MPI_LONG, 0, MPI_COMM_WORLD);
+  if (pid() > 0)
+    last = malloc (3*max (n, 1)*sizeof(float));
+  MPI_Bcast (last, 3*n, MPI_FLOAT, 0, MPI_COMM_WORLD);
+#endif
+  for (long k = 0; k < n; k++) {
+    double x = last[3*k + 1], y = last[3*k + 2];
+    if (tracer_local (x, y))
+      tracer_push (l, (tracer){last[3*k], x, y, x, y});
+  }
+  free (last);
+  return n;
+}